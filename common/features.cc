@@ -369,6 +369,70 @@ const base::Feature kBlinkHeapIncrementalMarking{
 // also adds additional verification passes.
 const base::Feature kBlinkHeapIncrementalMarkingStress{
     "BlinkHeapIncrementalMarkingStress", base::FEATURE_DISABLED_BY_DEFAULT};
+// Enables filtering the slots of compacted backing stores on multiple threads
+// in the atomic pause of a compacting garbage collection.
+const base::Feature kBlinkHeapParallelCompaction{
+    "BlinkHeapParallelCompaction", base::FEATURE_DISABLED_BY_DEFAULT};
+// Enables scheduling minor garbage collections of the young generation based
+// on the allocation volume since the previous garbage collection. Only has an
+// effect in builds with BLINK_HEAP_YOUNG_GENERATION.
+const base::Feature kBlinkHeapYoungGeneration{
+    "BlinkHeapYoungGeneration", base::FEATURE_DISABLED_BY_DEFAULT};
+
+// Enables a process-wide table of static atomic strings that is shared by all
+// threads, instead of copying the static strings into the atomic string table
+// of every worker and worklet thread.
+const base::Feature kSharedAtomicStringTable{"SharedAtomicStringTable",
+                                             base::FEATURE_DISABLED_BY_DEFAULT};
+
+// Allocates the backings of temporary layout containers, such as the item
+// results of a line, from a per-thread arena that is released in bulk at the
+// end of each layout.
+const base::Feature kLifecycleArena{"LifecycleArena",
+                                    base::FEATURE_DISABLED_BY_DEFAULT};
+
+// Stores the V8 code caches of all the module scripts of a module graph along
+// with the code cache of its root module script, so that they are available
+// as soon as the root module script is fetched again.
+const base::Feature kModuleGraphCodeCache{"ModuleGraphCodeCache",
+                                          base::FEATURE_DISABLED_BY_DEFAULT};
+
+// Streams module scripts fetched by documents to V8 while they load, like
+// classic scripts, so that they are parsed off the main thread.
+const base::Feature kModuleScriptStreaming{"ModuleScriptStreaming",
+                                           base::FEATURE_DISABLED_BY_DEFAULT};
+
+// Copies large array buffers posted with postMessage() without being
+// transferred next to the message instead of into it, so that the receiver
+// adopts the copy instead of copying it again.
+const base::Feature kCloneArrayBuffersOutOfBand{
+    "CloneArrayBuffersOutOfBand", base::FEATURE_DISABLED_BY_DEFAULT};
+
+// Serializes arrays of objects that share their property keys with a table of
+// the keys instead of with the keys of every object.
+const base::Feature kShapedObjectArraySerialization{
+    "ShapedObjectArraySerialization", base::FEATURE_DISABLED_BY_DEFAULT};
+
+// Makes ResourceLoadScheduler start the requests that it can run in batches,
+// in priority order, from a task instead of one by one as they are requested.
+const base::Feature kBatchResourceLoadScheduling{
+    "BatchResourceLoadScheduling", base::FEATURE_DISABLED_BY_DEFAULT};
+
+// Makes MemoryCache prune the decoded data of the resources that are the
+// cheapest to decode again per byte and the least often reused first, instead
+// of in an arbitrary order.
+const base::Feature kCostAwareMemoryCacheEviction{
+    "CostAwareMemoryCacheEviction", base::FEATURE_DISABLED_BY_DEFAULT};
+
+// Makes Resource reserve a contiguous buffer for the body of a response of
+// known length, so that its consumers can read it without merging segments.
+const base::Feature kContiguousResourceBuffer{
+    "ContiguousResourceBuffer", base::FEATURE_DISABLED_BY_DEFAULT};
+
+// Makes Resource hash the body of a response with integrity metadata as it
+// arrives, instead of all at once when it has finished loading.
+const base::Feature kIncrementalSubresourceIntegrity{
+    "IncrementalSubresourceIntegrity", base::FEATURE_DISABLED_BY_DEFAULT};
 
 // Enables removing AppCache delays when triggering requests when the HTML was
 // not fetched from AppCache.
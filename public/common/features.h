@@ -108,9 +108,32 @@ BLINK_COMMON_EXPORT extern const base::Feature kBlinkHeapCompaction;
 BLINK_COMMON_EXPORT extern const base::Feature kBlinkHeapConcurrentMarking;
 BLINK_COMMON_EXPORT extern const base::Feature kBlinkHeapConcurrentSweeping;
 BLINK_COMMON_EXPORT extern const base::Feature kBlinkHeapIncrementalMarking;
+BLINK_COMMON_EXPORT extern const base::Feature kBlinkHeapParallelCompaction;
+BLINK_COMMON_EXPORT extern const base::Feature kBlinkHeapYoungGeneration;
 BLINK_COMMON_EXPORT extern const base::Feature
     kBlinkHeapIncrementalMarkingStress;
 
+BLINK_COMMON_EXPORT extern const base::Feature kSharedAtomicStringTable;
+
+BLINK_COMMON_EXPORT extern const base::Feature kLifecycleArena;
+
+BLINK_COMMON_EXPORT extern const base::Feature kModuleGraphCodeCache;
+
+BLINK_COMMON_EXPORT extern const base::Feature kModuleScriptStreaming;
+
+BLINK_COMMON_EXPORT extern const base::Feature kCloneArrayBuffersOutOfBand;
+
+BLINK_COMMON_EXPORT extern const base::Feature kShapedObjectArraySerialization;
+
+BLINK_COMMON_EXPORT extern const base::Feature kBatchResourceLoadScheduling;
+
+BLINK_COMMON_EXPORT extern const base::Feature kCostAwareMemoryCacheEviction;
+
+BLINK_COMMON_EXPORT extern const base::Feature kContiguousResourceBuffer;
+
+BLINK_COMMON_EXPORT extern const base::Feature
+    kIncrementalSubresourceIntegrity;
+
 BLINK_COMMON_EXPORT extern const base::Feature
     kVerifyHTMLFetchedFromAppCacheBeforeDelay;
 
@@ -15,6 +15,7 @@
 #include "third_party/blink/renderer/core/dom/events/event_target.h"
 #include "third_party/blink/renderer/platform/bindings/exception_state.h"
 #include "third_party/blink/renderer/platform/bindings/v8_binding.h"
+#include "v8/include/v8-fast-api-calls.h"
 #include "v8/include/v8.h"
 
 namespace blink {
@@ -31,6 +32,17 @@ CORE_EXPORT void V8ConstructorAttributeGetter(
     const v8::PropertyCallbackInfo<v8::Value>&,
     const WrapperTypeInfo*);
 
+// Returns the ScriptWrappable of the receiver of a V8 Fast API callback of a
+// [NoAllocDirectCall] attribute getter or operation. V8 only calls those for
+// receivers that passed the holder check.
+inline ScriptWrappable* ToScriptWrappable(v8::ApiObject receiver) {
+  // An ApiObject holds the address of the object, like the slot that a
+  // v8::Local points to.
+  v8::Object* wrapper = reinterpret_cast<v8::Object*>(&receiver);
+  return static_cast<ScriptWrappable*>(
+      wrapper->GetAlignedPointerFromInternalField(kV8DOMWrapperObjectIndex));
+}
+
 // ExceptionToRejectPromiseScope converts a possible exception to a reject
 // promise and returns the promise instead of throwing the exception.
 //
@@ -96,7 +96,10 @@ v8::Local<v8::Module> ModuleRecord::Compile(
     V8CacheOptions v8_cache_options,
     SingleCachedMetadataHandler* cache_handler,
     ScriptSourceLocationType source_location_type,
-    ModuleRecordProduceCacheData** out_produce_cache_data) {
+    ModuleRecordProduceCacheData** out_produce_cache_data,
+    v8::ScriptCompiler::CachedData* module_graph_code_cache,
+    ScriptStreamer* streamer,
+    ScriptStreamer::NotStreamingReason not_streaming_reason) {
   v8::TryCatch try_catch(isolate);
   v8::Local<v8::Module> module;
 
@@ -114,10 +117,21 @@ v8::Local<v8::Module> ModuleRecord::Compile(
       V8CodeCache::GetCompileOptions(v8_cache_options, cache_handler,
                                      source.length(), source_location_type);
 
+  // A code cache from the module graph code cache takes precedence over the
+  // state of |cache_handler|. The module graph code cache is updated as a
+  // whole, so don't produce a code cache for this module alone.
+  if (module_graph_code_cache) {
+    compile_options = v8::ScriptCompiler::kConsumeCodeCache;
+    produce_cache_options = V8CodeCache::ProduceCacheOptions::kNoProduceCache;
+    no_cache_reason = v8::ScriptCompiler::kNoCacheNoReason;
+  }
+
   if (!V8ScriptRunner::CompileModule(isolate, source, cache_handler, source_url,
                                      text_position, compile_options,
                                      no_cache_reason,
-                                     ReferrerScriptInfo(base_url, options))
+                                     ReferrerScriptInfo(base_url, options),
+                                     module_graph_code_cache, streamer,
+                                     not_streaming_reason)
            .ToLocal(&module)) {
     DCHECK(try_catch.HasCaught());
     exception_state.RethrowV8Exception(try_catch.Exception());
@@ -6,6 +6,7 @@
 #define THIRD_PARTY_BLINK_RENDERER_BINDINGS_CORE_V8_MODULE_RECORD_H_
 
 #include "third_party/blink/renderer/bindings/core/v8/script_source_location_type.h"
+#include "third_party/blink/renderer/bindings/core/v8/script_streamer.h"
 #include "third_party/blink/renderer/bindings/core/v8/v8_code_cache.h"
 #include "third_party/blink/renderer/core/core_export.h"
 #include "third_party/blink/renderer/platform/bindings/trace_wrapper_v8_reference.h"
@@ -86,9 +87,24 @@ class CORE_EXPORT ModuleRecordProduceCacheData final
     return unbound_script_.NewLocal(isolate);
   }
 
+  // Set when the module graph code cache is enabled. |source_hash| is the
+  // ModuleGraphCodeCache::SourceHash() of the source text, and |consumed| is
+  // true if the module was compiled with a code cache from a module graph
+  // code cache.
+  void SetModuleGraphCodeCacheState(uint32_t source_hash, bool consumed) {
+    module_graph_source_hash_ = source_hash;
+    consumed_module_graph_code_cache_ = consumed;
+  }
+  bool ConsumedModuleGraphCodeCache() const {
+    return consumed_module_graph_code_cache_;
+  }
+  uint32_t ModuleGraphSourceHash() const { return module_graph_source_hash_; }
+
  private:
   Member<SingleCachedMetadataHandler> cache_handler_;
   V8CodeCache::ProduceCacheOptions produce_cache_options_;
+  bool consumed_module_graph_code_cache_ = false;
+  uint32_t module_graph_source_hash_ = 0;
 
   // TODO(keishi): Visitor only defines a trace method for v8::Value so this
   // needs to be cast.
@@ -113,7 +129,11 @@ class CORE_EXPORT ModuleRecord final {
       SingleCachedMetadataHandler* = nullptr,
       ScriptSourceLocationType source_location_type =
           ScriptSourceLocationType::kInternal,
-      ModuleRecordProduceCacheData** out_produce_cache_data = nullptr);
+      ModuleRecordProduceCacheData** out_produce_cache_data = nullptr,
+      v8::ScriptCompiler::CachedData* module_graph_code_cache = nullptr,
+      ScriptStreamer* streamer = nullptr,
+      ScriptStreamer::NotStreamingReason not_streaming_reason =
+          ScriptStreamer::kModuleScript);
 
   // Returns exception, if any.
   static ScriptValue Instantiate(ScriptState*,
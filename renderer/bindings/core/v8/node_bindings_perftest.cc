@@ -0,0 +1,96 @@
+// Copyright 2020 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <string>
+
+#include "base/time/time.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+#include "third_party/blink/renderer/bindings/core/v8/script_controller.h"
+#include "third_party/blink/renderer/bindings/core/v8/v8_binding_for_testing.h"
+#include "third_party/blink/renderer/core/frame/local_frame.h"
+
+namespace blink {
+
+namespace {
+
+constexpr char kMetricPrefixNodeBindings[] = "NodeBindings.";
+constexpr char kMetricThroughput[] = "throughput";
+
+constexpr int kNumRounds = 200;
+
+// Builds a tree of about 10000 nodes in the body of the document.
+constexpr char kBuildTree[] =
+    "(function build(parent, depth) {"
+    "  for (let i = 0; i < 10; ++i) {"
+    "    const child = document.createElement('div');"
+    "    child.appendChild(document.createTextNode('text'));"
+    "    if (depth > 0)"
+    "      build(child, depth - 1);"
+    "    parent.appendChild(child);"
+    "  }"
+    "})(document.body, 3);";
+
+// Defines walk(), which visits every node of the body in tree order and
+// returns the number of element nodes. The walk reads nodeType and calls
+// hasChildNodes() once per node, so their getters dominate along with
+// firstChild, nextSibling and parentNode.
+constexpr char kDefineWalk[] =
+    "function walk() {"
+    "  let elements = 0;"
+    "  let node = document.body;"
+    "  while (node) {"
+    "    if (node.nodeType === Node.ELEMENT_NODE)"
+    "      ++elements;"
+    "    if (node.hasChildNodes()) {"
+    "      node = node.firstChild;"
+    "      continue;"
+    "    }"
+    "    while (node && !node.nextSibling && node !== document.body)"
+    "      node = node.parentNode;"
+    "    if (!node || node === document.body)"
+    "      break;"
+    "    node = node.nextSibling;"
+    "  }"
+    "  return elements;"
+    "}";
+
+v8::Local<v8::Value> Execute(V8TestingScope& scope, const char* script) {
+  return scope.GetFrame()
+      .GetScriptController()
+      .ExecuteScriptInMainWorldAndReturnValue(script, KURL(),
+                                              SanitizeScriptErrors::kSanitize);
+}
+
+// The [NoAllocDirectCall] fast paths of nodeType and hasChildNodes() are only
+// taken by optimized code, and only with --js-flags=--turbo-fast-api-calls,
+// so comparing runs with and without that flag measures them.
+TEST(NodeBindingsPerfTest, TreeWalk) {
+  V8TestingScope scope;
+  perf_test::PerfResultReporter reporter(kMetricPrefixNodeBindings,
+                                         "tree_walk");
+  reporter.RegisterImportantMetric(kMetricThroughput, "nodes/s");
+
+  Execute(scope, kBuildTree);
+  Execute(scope, kDefineWalk);
+  v8::Local<v8::Value> element_count = Execute(scope, "walk()");
+  ASSERT_TRUE(element_count->IsNumber());
+  // Each element but the body has a text node child.
+  const double node_count = 2 * element_count.As<v8::Number>()->Value() - 1;
+
+  // Lets V8 optimize walk() before measuring.
+  for (int round = 0; round < kNumRounds / 10; ++round)
+    Execute(scope, "walk()");
+
+  base::TimeTicks start = base::TimeTicks::Now();
+  for (int round = 0; round < kNumRounds; ++round)
+    Execute(scope, "walk()");
+  base::TimeDelta elapsed = base::TimeTicks::Now() - start;
+  reporter.AddResult(kMetricThroughput,
+                     kNumRounds * node_count / elapsed.InSecondsF());
+}
+
+}  // namespace
+
+}  // namespace blink
@@ -12,6 +12,7 @@
 #include "base/threading/thread_restrictions.h"
 #include "mojo/public/cpp/system/wait.h"
 #include "third_party/blink/public/common/features.h"
+#include "third_party/blink/public/mojom/script/script_type.mojom-blink.h"
 #include "third_party/blink/renderer/bindings/core/v8/v8_code_cache.h"
 #include "third_party/blink/renderer/core/dom/document.h"
 #include "third_party/blink/renderer/core/dom/element.h"
@@ -464,6 +465,17 @@ bool ScriptStreamer::TryStartStreaming(
     return false;
   }
 
+  if (script_type_ == mojom::ScriptType::kModule &&
+      V8CodeCache::HasModuleGraphCodeCache(script_resource_->CacheHandler())) {
+    // The resource is the root of a module graph whose code caches were
+    // stored together, including its own. Compiling with the code cache is
+    // cheaper than streaming, and keeps the code cache of the graph intact.
+    SuppressStreaming(ScriptStreamer::kHasCodeCache);
+    stream_ = nullptr;
+    source_.reset();
+    return false;
+  }
+
   DCHECK(!stream_);
   DCHECK(!source_);
   auto stream_ptr = std::make_unique<SourceStream>();
@@ -474,10 +486,20 @@ bool ScriptStreamer::TryStartStreaming(
       std::move(stream_ptr), encoding_);
 
   std::unique_ptr<v8::ScriptCompiler::ScriptStreamingTask>
-      script_streaming_task(
-          base::WrapUnique(v8::ScriptCompiler::StartStreamingScript(
-              V8PerIsolateData::MainThreadIsolate(), source_.get(),
-              compile_options_)));
+      script_streaming_task;
+  if (script_type_ == mojom::ScriptType::kModule) {
+    // V8 doesn't produce cached data while streaming module scripts; their
+    // code cache is produced after evaluation instead.
+    DCHECK_EQ(compile_options_, v8::ScriptCompiler::kNoCompileOptions);
+    script_streaming_task = base::WrapUnique(v8::ScriptCompiler::StartStreaming(
+        V8PerIsolateData::MainThreadIsolate(), source_.get(),
+        v8::ScriptType::kModule));
+  } else {
+    script_streaming_task =
+        base::WrapUnique(v8::ScriptCompiler::StartStreamingScript(
+            V8PerIsolateData::MainThreadIsolate(), source_.get(),
+            compile_options_));
+  }
   if (!script_streaming_task) {
     // V8 cannot stream the script.
     SuppressStreaming(kV8CannotStream);
@@ -529,6 +551,7 @@ void ScriptStreamer::NotifyFinished() {
 ScriptStreamer::ScriptStreamer(
     ScriptResource* script_resource,
     v8::ScriptCompiler::CompileOptions compile_options,
+    mojom::ScriptType script_type,
     scoped_refptr<base::SingleThreadTaskRunner> loading_task_runner)
     : script_resource_(script_resource),
       detached_(false),
@@ -539,6 +562,7 @@ ScriptStreamer::ScriptStreamer(
       streaming_suppressed_(false),
       suppressed_reason_(kInvalid),
       compile_options_(compile_options),
+      script_type_(script_type),
       script_url_string_(script_resource->Url().Copy().GetString()),
       script_resource_identifier_(script_resource->InspectorId()),
       // Unfortunately there's no dummy encoding value in the enum; let's use
@@ -599,6 +623,7 @@ void ScriptStreamer::NotifyFinishedToClient() {
 
 ScriptStreamer* ScriptStreamer::Create(
     ScriptResource* resource,
+    mojom::ScriptType script_type,
     scoped_refptr<base::SingleThreadTaskRunner> loading_task_runner,
     NotStreamingReason* not_streaming_reason) {
   DCHECK(IsMainThread());
@@ -619,7 +644,7 @@ ScriptStreamer* ScriptStreamer::Create(
   // downloads.
 
   return MakeGarbageCollected<ScriptStreamer>(
-      resource, v8::ScriptCompiler::kNoCompileOptions,
+      resource, v8::ScriptCompiler::kNoCompileOptions, script_type,
       std::move(loading_task_runner));
 }
 
@@ -10,6 +10,7 @@
 #include "base/macros.h"
 #include "base/single_thread_task_runner.h"
 #include "mojo/public/cpp/system/data_pipe.h"
+#include "third_party/blink/public/mojom/script/script_type.mojom-blink-forward.h"
 #include "third_party/blink/renderer/core/core_export.h"
 #include "third_party/blink/renderer/platform/heap/handle.h"
 #include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
@@ -23,11 +24,11 @@ class ResponseBodyLoaderClient;
 
 // ScriptStreamer streams incomplete script data to V8 so that it can be parsed
 // while it's loaded. ScriptResource holds a reference to ScriptStreamer.
-// At the moment, ScriptStreamer is only used for parser blocking scripts; this
-// means that the Document stays stable and no other scripts are executing
-// while we're streaming. It is possible, though, that Document and the
-// ClassicPendingScript are destroyed while the streaming is in progress, and
-// ScriptStreamer handles it gracefully.
+// At the moment, ScriptStreamer is only used for classic scripts and module
+// scripts loaded by documents; this means that the Document stays stable and
+// no other scripts are executing while we're streaming. It is possible,
+// though, that Document and the ClassicPendingScript are destroyed while the
+// streaming is in progress, and ScriptStreamer handles it gracefully.
 class CORE_EXPORT ScriptStreamer final
     : public GarbageCollected<ScriptStreamer> {
   USING_PRE_FINALIZER(ScriptStreamer, Prefinalize);
@@ -55,6 +56,7 @@ class CORE_EXPORT ScriptStreamer final
     kSecondScriptResourceUse,
     kWorkerTopLevelScript,
     kModuleScript,
+    kScriptTypeMismatch,
 
     // Pseudo values that should never be seen in reported metrics
     kCount,
@@ -63,13 +65,16 @@ class CORE_EXPORT ScriptStreamer final
 
   ScriptStreamer(ScriptResource*,
                  v8::ScriptCompiler::CompileOptions,
+                 mojom::ScriptType,
                  scoped_refptr<base::SingleThreadTaskRunner>);
   ~ScriptStreamer();
   void Trace(Visitor*);
 
   // Create a script streamer which will stream the given ScriptResource into V8
-  // as it loads.
+  // as it loads. The script is parsed as a classic or a module script
+  // depending on |script_type|.
   static ScriptStreamer* Create(ScriptResource*,
+                                mojom::ScriptType script_type,
                                 scoped_refptr<base::SingleThreadTaskRunner>,
                                 NotStreamingReason* not_streaming_reason);
 
@@ -82,6 +87,10 @@ class CORE_EXPORT ScriptStreamer final
 
   v8::ScriptCompiler::StreamedSource* Source() { return source_.get(); }
 
+  // Whether the script is streamed as a classic or a module script. The
+  // streamed source can only be compiled as a script of this type.
+  mojom::ScriptType GetScriptType() const { return script_type_; }
+
   // Called when the script is not needed any more (e.g., loading was
   // cancelled). After calling cancel, ClassicPendingScript can drop its
   // reference to ScriptStreamer, and ScriptStreamer takes care of eventually
@@ -165,6 +174,8 @@ class CORE_EXPORT ScriptStreamer final
   // What kind of cached data V8 produces during streaming.
   v8::ScriptCompiler::CompileOptions compile_options_;
 
+  const mojom::ScriptType script_type_;
+
   // Keep the script URL string for event tracing.
   const String script_url_string_;
 
@@ -8,7 +8,10 @@
 #include <utility>
 
 #include "base/single_thread_task_runner.h"
+#include "base/test/scoped_feature_list.h"
 #include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/public/common/features.h"
+#include "third_party/blink/public/mojom/script/script_type.mojom-blink.h"
 #include "third_party/blink/public/platform/platform.h"
 #include "third_party/blink/public/platform/scheduler/test/renderer_scheduler_test_support.h"
 #include "third_party/blink/public/platform/web_url_loader.h"
@@ -115,7 +118,8 @@ class NoopLoaderFactory final : public ResourceFetcher::LoaderFactory {
 
 class ScriptStreamingTest : public testing::Test {
  public:
-  ScriptStreamingTest()
+  explicit ScriptStreamingTest(
+      mojom::ScriptType script_type = mojom::ScriptType::kClassic)
       : url_("http://www.streaming-test.com/"),
         loading_task_runner_(platform_->test_task_runner()) {
     auto* properties = MakeGarbageCollected<TestResourceFetcherProperties>();
@@ -130,7 +134,8 @@ class ScriptStreamingTest : public testing::Test {
     resource_client_ = MakeGarbageCollected<TestResourceClient>();
     FetchParameters params(std::move(request));
     resource_ = ScriptResource::Fetch(params, fetcher, resource_client_,
-                                      ScriptResource::kAllowStreaming);
+                                      ScriptResource::kAllowStreaming,
+                                      script_type);
     resource_->AddClient(resource_client_, loading_task_runner_.get());
 
     ScriptStreamer::SetSmallScriptThresholdForTesting(0);
@@ -280,6 +285,78 @@ TEST_F(ScriptStreamingTest, DISABLED_CompilingStreamedScriptWithParseError) {
   EXPECT_TRUE(try_catch.HasCaught());
 }
 
+class ModuleScriptStreamingTest : public ScriptStreamingTest {
+ public:
+  ModuleScriptStreamingTest()
+      : ScriptStreamingTest(mojom::ScriptType::kModule) {}
+};
+
+// TODO(crbug.com/939054): Tests are disabled due to flakiness caused by being
+// currently unable to block and wait for the script streaming thread.
+TEST_F(ModuleScriptStreamingTest, DISABLED_CompilingStreamedModuleScript) {
+  // Test that we can successfully compile a streamed module script.
+  V8TestingScope scope;
+  resource_->SetClientIsWaitingForFinished();
+
+  AppendData("export function foo() {");
+  AppendPadding();
+  AppendData("return 5; }");
+  AppendPadding();
+  AppendData("import.meta;");
+  EXPECT_FALSE(resource_client_->Finished());
+  Finish();
+
+  ProcessTasksUntilStreamingComplete();
+  EXPECT_TRUE(resource_client_->Finished());
+  ScriptStreamer* streamer = resource_->TakeStreamer();
+  ASSERT_TRUE(streamer);
+  EXPECT_EQ(mojom::ScriptType::kModule, streamer->GetScriptType());
+  EXPECT_FALSE(streamer->StreamingSuppressed());
+  v8::TryCatch try_catch(scope.GetIsolate());
+  v8::Local<v8::Module> module;
+  EXPECT_TRUE(V8ScriptRunner::CompileModule(
+                  scope.GetIsolate(), resource_->SourceText().ToString(),
+                  nullptr, url_.GetString(), TextPosition::MinimumPosition(),
+                  v8::ScriptCompiler::kNoCompileOptions,
+                  v8::ScriptCompiler::kNoCacheNoReason, ReferrerScriptInfo(),
+                  nullptr, streamer, ScriptStreamer::kInvalid)
+                  .ToLocal(&module));
+  EXPECT_FALSE(try_catch.HasCaught());
+}
+
+// TODO(crbug.com/939054): Tests are disabled due to flakiness caused by being
+// currently unable to block and wait for the script streaming thread.
+TEST_F(ModuleScriptStreamingTest,
+       DISABLED_SuppressingStreamingWithModuleGraphCodeCache) {
+  // The root module script of a module graph whose code caches were stored
+  // together is compiled with its code cache, so that the module graph code
+  // cache is consumed instead of being replaced by a streamed compile.
+  base::test::ScopedFeatureList feature_list;
+  feature_list.InitWithFeatures(
+      {features::kModuleScriptStreaming, features::kModuleGraphCodeCache}, {});
+  V8TestingScope scope;
+  resource_->StartStreaming(loading_task_runner_);
+  resource_->SetClientIsWaitingForFinished();
+
+  SingleCachedMetadataHandler* cache_handler = resource_->CacheHandler();
+  EXPECT_TRUE(cache_handler);
+  cache_handler->DisableSendToPlatformForTesting();
+  cache_handler->SetCachedMetadata(
+      V8CodeCache::TagForModuleGraphCodeCache(cache_handler),
+      reinterpret_cast<const uint8_t*>("X"), 1);
+  EXPECT_FALSE(V8CodeCache::HasCodeCache(cache_handler));
+
+  AppendData("export function foo() {");
+  AppendPadding();
+  Finish();
+  ProcessTasksUntilStreamingComplete();
+  EXPECT_TRUE(resource_client_->Finished());
+
+  ScriptSourceCode source_code = GetScriptSourceCode();
+  EXPECT_FALSE(source_code.Streamer());
+  EXPECT_EQ(ScriptStreamer::kHasCodeCache, source_code.NotStreamingReason());
+}
+
 // TODO(crbug.com/939054): Tests are disabled due to flakiness caused by being
 // currently unable to block and wait for the script streaming thread.
 TEST_F(ScriptStreamingTest, DISABLED_CancellingStreaming) {
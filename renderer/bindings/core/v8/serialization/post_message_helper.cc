@@ -4,6 +4,8 @@
 
 #include "third_party/blink/renderer/bindings/core/v8/serialization/post_message_helper.h"
 
+#include "base/feature_list.h"
+#include "third_party/blink/public/common/features.h"
 #include "third_party/blink/public/mojom/messaging/user_activation_snapshot.mojom-blink.h"
 #include "third_party/blink/renderer/bindings/core/v8/serialization/serialized_script_value.h"
 #include "third_party/blink/renderer/bindings/core/v8/v8_post_message_options.h"
@@ -30,6 +32,9 @@ scoped_refptr<SerializedScriptValue> PostMessageHelper::SerializeMessageByMove(
 
   SerializedScriptValue::SerializeOptions serialize_options;
   serialize_options.transferables = &transferables;
+  // Messages posted by move are always unpacked before they are deserialized.
+  serialize_options.clone_array_buffers_out_of_band =
+      base::FeatureList::IsEnabled(features::kCloneArrayBuffersOutOfBand);
   scoped_refptr<SerializedScriptValue> serialized_message =
       SerializedScriptValue::Serialize(isolate, message.V8Value(),
                                        serialize_options, exception_state);
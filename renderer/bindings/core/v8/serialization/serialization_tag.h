@@ -113,6 +113,12 @@ enum SerializationTag {
   kDeprecatedDetectedTextTag = 't',
 
   kDOMExceptionTag = 'x',  // name:String,message:String,stack:String
+  // Only between the Blink envelope and the V8 header. The value is then an
+  // array of objects, written as shapeCount:uint32_t, shapeCount shapes of
+  // (keyCount:uint32_t, keyCount keys), length:uint32_t, and length objects
+  // of (shape:uint32_t, a value for each key of the shape). Keys and values
+  // are written by V8.
+  kShapedObjectArrayTag = 'S',
   kVersionTag = 0xFF       // version:uint32_t -> Uses this as the file version.
 };
 
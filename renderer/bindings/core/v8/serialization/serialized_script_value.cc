@@ -463,6 +463,16 @@ void SerializedScriptValue::TransferArrayBuffers(
       TransferArrayBufferContents(isolate, array_buffers, exception_state);
 }
 
+bool SerializedScriptValue::CloneArrayBufferOutOfBand(
+    DOMArrayBuffer* array_buffer) {
+  ArrayBufferContents contents;
+  array_buffer->Content()->CopyTo(contents);
+  if (!contents.IsValid())
+    return false;
+  array_buffer_contents_array_.push_back(std::move(contents));
+  return true;
+}
+
 void SerializedScriptValue::CloneSharedArrayBuffers(
     SharedArrayBufferArray& array_buffers) {
   if (!array_buffers.size())
@@ -53,6 +53,7 @@
 namespace blink {
 
 class BlobDataHandle;
+class DOMArrayBuffer;
 class DOMSharedArrayBuffer;
 class ExceptionState;
 class ExecutionContext;
@@ -98,6 +99,8 @@ class CORE_EXPORT SerializedScriptValue
   //             support color space information, compression, etc.
   // Version 19: Add DetectedBarcode, DetectedFace, and DetectedText support.
   // Version 20: Remove DetectedBarcode, DetectedFace, and DetectedText support.
+  // Version 21: Add ShapedObjectArrayTag for arrays of objects sharing a few
+  //             sets of property keys.
   //
   // The following versions cannot be used, in order to be able to
   // deserialize version 0 SSVs. The class implementation has details.
@@ -110,7 +113,7 @@ class CORE_EXPORT SerializedScriptValue
   //
   // Recent changes are routinely reverted in preparation for branch, and this
   // has been the cause of at least one bug in the past.
-  static constexpr uint32_t kWireFormatVersion = 20;
+  static constexpr uint32_t kWireFormatVersion = 21;
 
   // This enumeration specifies whether we're serializing a value for storage;
   // e.g. when writing to IndexedDB. This corresponds to the forStorage flag of
@@ -143,6 +146,12 @@ class CORE_EXPORT SerializedScriptValue
     WebBlobInfoArray* blob_info = nullptr;
     WasmSerializationPolicy wasm_policy = kTransfer;
     StoragePolicy for_storage = kNotForStorage;
+    // If the value is a large ArrayBuffer or a view on one, its contents are
+    // copied next to the contents of the transferred array buffers instead of
+    // into the wire data, and the deserialized ArrayBuffer adopts them. This
+    // saves a copy, but the SerializedScriptValue must be unpacked before it
+    // is deserialized. Ignored for storage.
+    bool clone_array_buffers_out_of_band = false;
   };
   static scoped_refptr<SerializedScriptValue> Serialize(v8::Isolate*,
                                                         v8::Local<v8::Value>,
@@ -327,6 +336,10 @@ class CORE_EXPORT SerializedScriptValue
   void TransferArrayBuffers(v8::Isolate*,
                             const ArrayBufferArray&,
                             ExceptionState&);
+  // Appends a copy of the contents of the ArrayBuffer to the contents of the
+  // transferred array buffers. Returns false if the copy couldn't be
+  // allocated.
+  bool CloneArrayBufferOutOfBand(DOMArrayBuffer*);
   void TransferImageBitmaps(v8::Isolate*,
                             const ImageBitmapArray&,
                             ExceptionState&);
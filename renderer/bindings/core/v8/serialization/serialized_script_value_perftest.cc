@@ -0,0 +1,94 @@
+// Copyright 2020 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <string>
+
+#include "base/test/scoped_feature_list.h"
+#include "base/time/time.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+#include "third_party/blink/public/common/features.h"
+#include "third_party/blink/renderer/bindings/core/v8/script_controller.h"
+#include "third_party/blink/renderer/bindings/core/v8/serialization/serialized_script_value.h"
+#include "third_party/blink/renderer/bindings/core/v8/serialization/v8_script_value_deserializer.h"
+#include "third_party/blink/renderer/bindings/core/v8/serialization/v8_script_value_serializer.h"
+#include "third_party/blink/renderer/bindings/core/v8/v8_binding_for_testing.h"
+#include "third_party/blink/renderer/core/frame/local_frame.h"
+#include "third_party/blink/renderer/platform/bindings/exception_state.h"
+
+namespace blink {
+
+namespace {
+
+constexpr char kMetricPrefixSerializedScriptValue[] = "SerializedScriptValue.";
+constexpr char kMetricSerializeThroughput[] = "serialize_throughput";
+constexpr char kMetricDeserializeThroughput[] = "deserialize_throughput";
+constexpr char kMetricWireSize[] = "wire_size";
+
+constexpr int kNumRounds = 20;
+
+// A snapshot of application state: an array of records with the same keys.
+constexpr char kRecords[] =
+    "Array.from({length: 10000}, (_, i) => ({"
+    "  id: i, name: 'item ' + i, price: i * 0.25, inStock: i % 2 == 0,"
+    "  category: ['a', 'b', 'c'][i % 3], updated: 1580000000000 + i}))";
+
+void RunBenchmark(const std::string& story_name, bool shape_table) {
+  base::test::ScopedFeatureList feature_list;
+  feature_list.InitWithFeatureState(features::kShapedObjectArraySerialization,
+                                    shape_table);
+  V8TestingScope scope;
+  perf_test::PerfResultReporter reporter(kMetricPrefixSerializedScriptValue,
+                                         story_name);
+  reporter.RegisterImportantMetric(kMetricSerializeThroughput, "records/s");
+  reporter.RegisterImportantMetric(kMetricDeserializeThroughput, "records/s");
+  reporter.RegisterImportantMetric(kMetricWireSize, "bytes");
+
+  v8::Local<v8::Value> records =
+      scope.GetFrame()
+          .GetScriptController()
+          .ExecuteScriptInMainWorldAndReturnValue(
+              kRecords, KURL(), SanitizeScriptErrors::kSanitize);
+  ASSERT_TRUE(records->IsArray());
+  const double record_count = records.As<v8::Array>()->Length();
+
+  scoped_refptr<SerializedScriptValue> serialized_script_value;
+  base::TimeTicks start = base::TimeTicks::Now();
+  for (int round = 0; round < kNumRounds; ++round) {
+    serialized_script_value = V8ScriptValueSerializer(scope.GetScriptState())
+                                  .Serialize(records, ASSERT_NO_EXCEPTION);
+  }
+  base::TimeDelta elapsed = base::TimeTicks::Now() - start;
+  ASSERT_TRUE(serialized_script_value);
+  reporter.AddResult(kMetricSerializeThroughput,
+                     kNumRounds * record_count / elapsed.InSecondsF());
+  reporter.AddResult(
+      kMetricWireSize,
+      static_cast<size_t>(serialized_script_value->DataLengthInBytes()));
+
+  start = base::TimeTicks::Now();
+  for (int round = 0; round < kNumRounds; ++round) {
+    v8::HandleScope handle_scope(scope.GetIsolate());
+    v8::Local<v8::Value> result =
+        V8ScriptValueDeserializer(scope.GetScriptState(),
+                                  serialized_script_value)
+            .Deserialize();
+    EXPECT_TRUE(result->IsArray());
+  }
+  elapsed = base::TimeTicks::Now() - start;
+  reporter.AddResult(kMetricDeserializeThroughput,
+                     kNumRounds * record_count / elapsed.InSecondsF());
+}
+
+TEST(SerializedScriptValuePerfTest, Records) {
+  RunBenchmark("records", false);
+}
+
+TEST(SerializedScriptValuePerfTest, RecordsWithShapeTable) {
+  RunBenchmark("records_with_shape_table", true);
+}
+
+}  // namespace
+
+}  // namespace blink
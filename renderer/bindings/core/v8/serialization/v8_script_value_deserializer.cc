@@ -56,6 +56,10 @@ namespace {
 // See also V8ScriptValueDeserializer.cpp.
 const uint32_t kMinVersionForSeparateEnvelope = 16;
 
+// The first version in which kShapedObjectArrayTag may follow the Blink
+// envelope.
+const uint32_t kMinVersionForShapedObjectArrays = 21;
+
 // Returns the number of bytes consumed reading the Blink version envelope, and
 // sets |*version| to the version. If no Blink envelope was detected, zero is
 // returned.
@@ -148,11 +152,24 @@ v8::Local<v8::Value> V8ScriptValueDeserializer::Deserialize() {
 
   size_t version_envelope_size =
       ReadVersionEnvelope(serialized_script_value_.get(), &version_);
+  bool is_shaped_object_array = false;
   if (version_envelope_size) {
     const void* blink_envelope;
     bool read_envelope = ReadRawBytes(version_envelope_size, &blink_envelope);
     DCHECK(read_envelope);
     DCHECK_GE(version_, kMinVersionForSeparateEnvelope);
+
+    // Otherwise, the V8 header, which starts with its own version tag,
+    // follows the envelope.
+    if (version_ >= kMinVersionForShapedObjectArrays &&
+        serialized_script_value_->DataLengthInBytes() > version_envelope_size &&
+        serialized_script_value_->Data()[version_envelope_size] ==
+            kShapedObjectArrayTag) {
+      SerializationTag tag;
+      bool read_tag = ReadTag(&tag);
+      DCHECK(read_tag);
+      is_shaped_object_array = true;
+    }
   } else {
     DCHECK_EQ(version_, 0u);
   }
@@ -171,11 +188,62 @@ v8::Local<v8::Value> V8ScriptValueDeserializer::Deserialize() {
   Transfer();
 
   v8::Local<v8::Value> value;
-  if (!deserializer_.ReadValue(context).ToLocal(&value))
+  if (!(is_shaped_object_array ? ReadShapedObjectArray()
+                               : deserializer_.ReadValue(context))
+           .ToLocal(&value)) {
     return v8::Null(isolate);
+  }
   return scope.Escape(value);
 }
 
+v8::MaybeLocal<v8::Value> V8ScriptValueDeserializer::ReadShapedObjectArray() {
+  v8::Isolate* isolate = script_state_->GetIsolate();
+  v8::Local<v8::Context> context = script_state_->GetContext();
+
+  // Counts are not trusted: every key, value and shape index takes at least
+  // one byte, so reading fails before the data runs out.
+  uint32_t shape_count;
+  if (!ReadUint32(&shape_count))
+    return v8::MaybeLocal<v8::Value>();
+  Vector<Vector<v8::Local<v8::Name>>> shapes;
+  for (uint32_t i = 0; i < shape_count; ++i) {
+    uint32_t key_count;
+    if (!ReadUint32(&key_count))
+      return v8::MaybeLocal<v8::Value>();
+    Vector<v8::Local<v8::Name>> keys;
+    for (uint32_t j = 0; j < key_count; ++j) {
+      v8::Local<v8::Value> key;
+      if (!deserializer_.ReadValue(context).ToLocal(&key) || !key->IsString())
+        return v8::MaybeLocal<v8::Value>();
+      keys.push_back(key.As<v8::Name>());
+    }
+    shapes.push_back(std::move(keys));
+  }
+
+  uint32_t length;
+  if (!ReadUint32(&length))
+    return v8::MaybeLocal<v8::Value>();
+  v8::Local<v8::Array> array = v8::Array::New(isolate);
+  for (uint32_t i = 0; i < length; ++i) {
+    uint32_t shape;
+    if (!ReadUint32(&shape) || shape >= shapes.size())
+      return v8::MaybeLocal<v8::Value>();
+    // Objects of a shape get their properties in the same order, so that they
+    // share their hidden classes.
+    v8::Local<v8::Object> object = v8::Object::New(isolate);
+    for (const auto& key : shapes[shape]) {
+      v8::Local<v8::Value> value;
+      if (!deserializer_.ReadValue(context).ToLocal(&value) ||
+          !object->CreateDataProperty(context, key, value).FromMaybe(false)) {
+        return v8::MaybeLocal<v8::Value>();
+      }
+    }
+    if (!array->CreateDataProperty(context, i, object).FromMaybe(false))
+      return v8::MaybeLocal<v8::Value>();
+  }
+  return array;
+}
+
 void V8ScriptValueDeserializer::Transfer() {
   if (TransferableStreamsEnabled()) {
     // TODO(ricea): Make ExtendableMessageEvent store an
@@ -94,6 +94,9 @@ class CORE_EXPORT V8ScriptValueDeserializer
                             const Options&);
   void Transfer();
 
+  // Reads an array written by V8ScriptValueSerializer with a shape table.
+  v8::MaybeLocal<v8::Value> ReadShapedObjectArray();
+
   File* ReadFile();
   File* ReadFileIndex();
 
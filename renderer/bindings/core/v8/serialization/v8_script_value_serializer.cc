@@ -5,9 +5,12 @@
 #include "third_party/blink/renderer/bindings/core/v8/serialization/v8_script_value_serializer.h"
 
 #include "base/auto_reset.h"
+#include "base/feature_list.h"
+#include "third_party/blink/public/common/features.h"
 #include "third_party/blink/public/mojom/web_feature/web_feature.mojom-blink.h"
 #include "third_party/blink/public/platform/web_blob_info.h"
 #include "third_party/blink/renderer/bindings/core/v8/to_v8_for_core.h"
+#include "third_party/blink/renderer/bindings/core/v8/v8_array_buffer.h"
 #include "third_party/blink/renderer/bindings/core/v8/v8_blob.h"
 #include "third_party/blink/renderer/bindings/core/v8/v8_dom_exception.h"
 #include "third_party/blink/renderer/bindings/core/v8/v8_dom_matrix.h"
@@ -42,12 +45,14 @@
 #include "third_party/blink/renderer/core/streams/readable_stream.h"
 #include "third_party/blink/renderer/core/streams/transform_stream.h"
 #include "third_party/blink/renderer/core/streams/writable_stream.h"
+#include "third_party/blink/renderer/core/typed_arrays/dom_array_buffer.h"
 #include "third_party/blink/renderer/core/typed_arrays/dom_array_buffer_base.h"
 #include "third_party/blink/renderer/platform/file_metadata.h"
 #include "third_party/blink/renderer/platform/instrumentation/use_counter.h"
 #include "third_party/blink/renderer/platform/runtime_enabled_features.h"
 #include "third_party/blink/renderer/platform/wtf/allocator/partitions.h"
 #include "third_party/blink/renderer/platform/wtf/date_math.h"
+#include "third_party/blink/renderer/platform/wtf/hash_map.h"
 #include "third_party/blink/renderer/platform/wtf/text/string_utf8_adaptor.h"
 
 namespace blink {
@@ -69,6 +74,74 @@ namespace blink {
 // made to how Blink writes data. Purely V8-side changes do not require an
 // adjustment to this value.
 
+namespace {
+
+// Array buffers smaller than this are copied into the wire data even if
+// SerializeOptions::clone_array_buffers_out_of_band is set, as the separate
+// allocation isn't worth it.
+constexpr size_t kMinOutOfBandArrayBufferSize = 64 * 1024;
+
+// Shorter arrays don't repeat their property keys enough to make up for the
+// shape table, and arrays with more shapes are unlikely to be records.
+constexpr uint32_t kMinShapedObjectArrayLength = 16;
+constexpr wtf_size_t kMaxShapedObjectArrayShapes = 16;
+
+using PropertyKeys = Vector<v8::Local<v8::Value>, 16>;
+
+// Whether |value| is an object that V8 would write as an ordinary object,
+// i.e. without internal state of its own.
+bool IsPlainObject(v8::Local<v8::Value> value,
+                   v8::Local<v8::Value> object_prototype) {
+  if (!value->IsObject() || value->IsProxy() || value->IsArray() ||
+      value->IsFunction() || value->IsArrayBuffer() ||
+      value->IsArrayBufferView() || value->IsSharedArrayBuffer() ||
+      value->IsDate() || value->IsRegExp() || value->IsMap() ||
+      value->IsSet() || value->IsNativeError() || value->IsBooleanObject() ||
+      value->IsNumberObject() || value->IsStringObject() ||
+      value->IsBigIntObject() || value->IsSymbolObject() ||
+      value->IsWasmModuleObject() || value->IsPromise()) {
+    return false;
+  }
+  v8::Local<v8::Object> object = value.As<v8::Object>();
+  // Host objects, such as wrappers of DOM objects, have internal fields.
+  // Interceptors would run callbacks when the properties are read.
+  return !object->InternalFieldCount() &&
+         !object->HasNamedLookupInterceptor() &&
+         !object->HasIndexedLookupInterceptor() &&
+         object->GetPrototype()->StrictEquals(object_prototype);
+}
+
+bool IsShapedObjectArrayValue(v8::Local<v8::Value> value) {
+  return value->IsString() || value->IsNumber() || value->IsBoolean() ||
+         value->IsNullOrUndefined() || value->IsBigInt();
+}
+
+bool HaveSameKeys(const PropertyKeys& keys,
+                  const Vector<v8::Local<v8::Value>>& shape) {
+  if (keys.size() != shape.size())
+    return false;
+  for (wtf_size_t i = 0; i < keys.size(); ++i) {
+    // Most property keys are internalized strings, compared by pointer.
+    if (!keys[i]->StrictEquals(shape[i]))
+      return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+struct V8ScriptValueSerializer::ShapedObjectArray {
+  STACK_ALLOCATED();
+
+ public:
+  // The property keys of each shape, in property order.
+  Vector<Vector<v8::Local<v8::Value>>> shapes;
+  // The shape of each object of the array.
+  Vector<uint32_t> object_shapes;
+  // The property values of all objects, in order.
+  Vector<v8::Local<v8::Value>> values;
+};
+
 V8ScriptValueSerializer::V8ScriptValueSerializer(ScriptState* script_state,
                                                  const Options& options)
     : script_state_(script_state),
@@ -77,7 +150,11 @@ V8ScriptValueSerializer::V8ScriptValueSerializer(ScriptState* script_state,
       transferables_(options.transferables),
       blob_info_array_(options.blob_info),
       wasm_policy_(options.wasm_policy),
-      for_storage_(options.for_storage == SerializedScriptValue::kForStorage) {}
+      for_storage_(options.for_storage == SerializedScriptValue::kForStorage),
+      clone_array_buffers_out_of_band_(
+          options.clone_array_buffers_out_of_band && !for_storage_),
+      write_shaped_object_arrays_(base::FeatureList::IsEnabled(
+          features::kShapedObjectArraySerialization)) {}
 
 scoped_refptr<SerializedScriptValue> V8ScriptValueSerializer::Serialize(
     v8::Local<v8::Value> value,
@@ -94,16 +171,29 @@ scoped_refptr<SerializedScriptValue> V8ScriptValueSerializer::Serialize(
   PrepareTransfer(exception_state);
   if (exception_state.HadException())
     return nullptr;
+  PrepareOutOfBandArrayBuffer(value);
+  v8::TryCatch try_catch(script_state_->GetIsolate());
+  ShapedObjectArray shaped_object_array;
+  bool is_shaped_object_array;
+  if (!PrepareShapedObjectArray(value, &shaped_object_array)
+           .To(&is_shaped_object_array)) {
+    DCHECK(try_catch.HasCaught());
+    exception_state.RethrowV8Exception(try_catch.Exception());
+    return nullptr;
+  }
 
   // Write out the file header.
   WriteTag(kVersionTag);
   WriteUint32(SerializedScriptValue::kWireFormatVersion);
+  if (is_shaped_object_array)
+    WriteTag(kShapedObjectArrayTag);
   serializer_.WriteHeader();
 
   // Serialize the value and handle errors.
-  v8::TryCatch try_catch(script_state_->GetIsolate());
   bool wrote_value;
-  if (!serializer_.WriteValue(script_state_->GetContext(), value)
+  if (!(is_shaped_object_array
+            ? WriteShapedObjectArray(shaped_object_array)
+            : serializer_.WriteValue(script_state_->GetContext(), value))
            .To(&wrote_value)) {
     DCHECK(try_catch.HasCaught());
     exception_state.RethrowV8Exception(try_catch.Exception());
@@ -145,6 +235,202 @@ void V8ScriptValueSerializer::PrepareTransfer(ExceptionState& exception_state) {
   }
 }
 
+void V8ScriptValueSerializer::PrepareOutOfBandArrayBuffer(
+    v8::Local<v8::Value> value) {
+  if (!clone_array_buffers_out_of_band_)
+    return;
+
+  // Only the value itself is considered: finding array buffers deeper in the
+  // value would run getters before serialization does.
+  v8::Local<v8::ArrayBuffer> v8_array_buffer;
+  if (value->IsArrayBuffer()) {
+    v8_array_buffer = value.As<v8::ArrayBuffer>();
+  } else if (value->IsArrayBufferView()) {
+    v8::Local<v8::ArrayBufferView> view = value.As<v8::ArrayBufferView>();
+    // Views without a buffer of their own are small.
+    if (!view->HasBuffer())
+      return;
+    v8_array_buffer = view->Buffer();
+  } else {
+    return;
+  }
+  // The buffer of a view may be a SharedArrayBuffer, which V8 sends shared
+  // anyway.
+  if (!v8_array_buffer->IsArrayBuffer())
+    return;
+  // Detached array buffers have no contents.
+  if (v8_array_buffer->ByteLength() < kMinOutOfBandArrayBufferSize)
+    return;
+
+  DOMArrayBuffer* array_buffer = V8ArrayBuffer::ToImpl(v8_array_buffer);
+  uint32_t id = 0;
+  if (transferables_) {
+    if (transferables_->array_buffers.Contains(array_buffer))
+      return;
+    id = transferables_->array_buffers.size();
+  }
+  serializer_.TransferArrayBuffer(id, v8_array_buffer);
+  out_of_band_array_buffer_ = array_buffer;
+}
+
+v8::Maybe<bool> V8ScriptValueSerializer::PrepareShapedObjectArray(
+    v8::Local<v8::Value> value,
+    ShapedObjectArray* result) {
+  if (!write_shaped_object_arrays_ || !value->IsArray())
+    return v8::Just(false);
+  v8::Local<v8::Array> array = value.As<v8::Array>();
+  const uint32_t length = array->Length();
+  if (length < kMinShapedObjectArrayLength ||
+      array->HasNamedLookupInterceptor() ||
+      array->HasIndexedLookupInterceptor()) {
+    return v8::Just(false);
+  }
+
+  // StructuredSerialize reads each property once, and V8 reads them again if
+  // it writes the array after all. So nothing here may run script: accessors
+  // are rejected instead of called, and the property values of ordinary
+  // objects are read without side effects. Exceptions are only thrown if
+  // execution is terminated.
+  v8::Isolate* isolate = script_state_->GetIsolate();
+  v8::Local<v8::Context> context = script_state_->GetContext();
+  const auto kEnumerableStrings = static_cast<v8::PropertyFilter>(
+      v8::ONLY_ENUMERABLE | v8::SKIP_SYMBOLS);
+
+  // The keys of the array, as strings, to look for accessor elements. V8 has
+  // no such lookup by index. Once every index is known to be present, there
+  // are exactly |length| keys if the array has no named properties, which are
+  // not written.
+  v8::Local<v8::Array> array_keys;
+  if (!array
+           ->GetPropertyNames(context, v8::KeyCollectionMode::kOwnOnly,
+                              kEnumerableStrings,
+                              v8::IndexFilter::kIncludeIndices,
+                              v8::KeyConversionMode::kConvertToString)
+           .ToLocal(&array_keys)) {
+    return v8::Nothing<bool>();
+  }
+  if (array_keys->Length() != length)
+    return v8::Just(false);
+
+  v8::Local<v8::Value> object_prototype =
+      v8::Object::New(isolate)->GetPrototype();
+  // The objects so far by identity hash. An object that occurs twice would be
+  // written as two objects. Identity hashes collide, so objects with the same
+  // hash are compared.
+  using Objects = Vector<v8::Local<v8::Object>, 1>;
+  HashMap<int, Objects> objects_by_hash;
+  result->object_shapes.ReserveInitialCapacity(length);
+  wtf_size_t shape = 0;
+  for (uint32_t i = 0; i < length; ++i) {
+    // Holes would be written as undefined.
+    bool has_element;
+    bool is_accessor = false;
+    v8::Local<v8::Value> index_key;
+    v8::Local<v8::Value> element;
+    if (!array->HasRealIndexedProperty(context, i).To(&has_element))
+      return v8::Nothing<bool>();
+    if (!has_element)
+      return v8::Just(false);
+    if (!array_keys->Get(context, i).ToLocal(&index_key) ||
+        !array->HasRealNamedCallbackProperty(context, index_key.As<v8::Name>())
+             .To(&is_accessor)) {
+      return v8::Nothing<bool>();
+    }
+    if (is_accessor)
+      return v8::Just(false);
+    if (!array->Get(context, i).ToLocal(&element))
+      return v8::Nothing<bool>();
+    if (!IsPlainObject(element, object_prototype))
+      return v8::Just(false);
+    v8::Local<v8::Object> object = element.As<v8::Object>();
+    Objects& same_hash_objects =
+        objects_by_hash.insert(object->GetIdentityHash(), Objects())
+            .stored_value->value;
+    for (const auto& same_hash_object : same_hash_objects) {
+      if (same_hash_object->StrictEquals(object))
+        return v8::Just(false);
+    }
+    same_hash_objects.push_back(object);
+
+    v8::Local<v8::Array> key_array;
+    if (!object
+             ->GetPropertyNames(context, v8::KeyCollectionMode::kOwnOnly,
+                                kEnumerableStrings,
+                                v8::IndexFilter::kIncludeIndices,
+                                v8::KeyConversionMode::kConvertToString)
+             .ToLocal(&key_array)) {
+      return v8::Nothing<bool>();
+    }
+    PropertyKeys keys;
+    keys.ReserveInitialCapacity(key_array->Length());
+    for (uint32_t j = 0; j < key_array->Length(); ++j) {
+      v8::Local<v8::Value> key;
+      if (!key_array->Get(context, j).ToLocal(&key))
+        return v8::Nothing<bool>();
+      if (!object->HasRealNamedCallbackProperty(context, key.As<v8::Name>())
+               .To(&is_accessor)) {
+        return v8::Nothing<bool>();
+      }
+      if (is_accessor)
+        return v8::Just(false);
+      keys.push_back(key);
+    }
+
+    // Consecutive objects usually have the same shape.
+    if (shape == result->shapes.size() ||
+        !HaveSameKeys(keys, result->shapes[shape])) {
+      for (shape = 0; shape < result->shapes.size(); ++shape) {
+        if (HaveSameKeys(keys, result->shapes[shape]))
+          break;
+      }
+      if (shape == result->shapes.size()) {
+        if (result->shapes.size() == kMaxShapedObjectArrayShapes)
+          return v8::Just(false);
+        result->shapes.push_back(Vector<v8::Local<v8::Value>>());
+        result->shapes.back().AppendRange(keys.begin(), keys.end());
+      }
+    }
+    result->object_shapes.push_back(shape);
+
+    for (const auto& key : keys) {
+      v8::Local<v8::Value> property_value;
+      if (!object->Get(context, key).ToLocal(&property_value))
+        return v8::Nothing<bool>();
+      if (!IsShapedObjectArrayValue(property_value))
+        return v8::Just(false);
+      result->values.push_back(property_value);
+    }
+  }
+  return v8::Just(true);
+}
+
+v8::Maybe<bool> V8ScriptValueSerializer::WriteShapedObjectArray(
+    const ShapedObjectArray& array) {
+  v8::Local<v8::Context> context = script_state_->GetContext();
+  WriteUint32(array.shapes.size());
+  for (const auto& shape : array.shapes) {
+    WriteUint32(shape.size());
+    for (const auto& key : shape) {
+      if (serializer_.WriteValue(context, key).IsNothing())
+        return v8::Nothing<bool>();
+    }
+  }
+
+  WriteUint32(array.object_shapes.size());
+  wtf_size_t value_index = 0;
+  for (uint32_t shape : array.object_shapes) {
+    WriteUint32(shape);
+    for (wtf_size_t i = 0; i < array.shapes[shape].size(); ++i) {
+      if (serializer_.WriteValue(context, array.values[value_index++])
+              .IsNothing()) {
+        return v8::Nothing<bool>();
+      }
+    }
+  }
+  DCHECK_EQ(value_index, array.values.size());
+  return v8::Just(true);
+}
+
 void V8ScriptValueSerializer::FinalizeTransfer(
     ExceptionState& exception_state) {
   // TODO(jbroman): Strictly speaking, this is not correct; transfer should
@@ -174,6 +460,15 @@ void V8ScriptValueSerializer::FinalizeTransfer(
       return;
   }
 
+  // The out-of-band array buffer follows the transferred ones, as the index
+  // given to V8 in PrepareOutOfBandArrayBuffer() assumes.
+  if (out_of_band_array_buffer_ &&
+      !serialized_script_value_->CloneArrayBufferOutOfBand(
+          out_of_band_array_buffer_)) {
+    exception_state.ThrowRangeError("Array buffer allocation failed");
+    return;
+  }
+
   if (transferables_) {
     serialized_script_value_->TransferImageBitmaps(
         isolate, transferables_->image_bitmaps, exception_state);
@@ -19,6 +19,7 @@
 
 namespace blink {
 
+class DOMArrayBuffer;
 class File;
 class Transferables;
 
@@ -86,6 +87,22 @@ class CORE_EXPORT V8ScriptValueSerializer
   void PrepareTransfer(ExceptionState&);
   void FinalizeTransfer(ExceptionState&);
 
+  // Lets V8 reference the ArrayBuffer of |value| by index, like a transferred
+  // one, if it should be cloned out of band. FinalizeTransfer() copies it.
+  void PrepareOutOfBandArrayBuffer(v8::Local<v8::Value> value);
+
+  // The objects of an array written with a shape table.
+  struct ShapedObjectArray;
+
+  // Returns true and fills |result| if |value| is an array of plain objects
+  // with primitive property values that share a few sets of property keys.
+  // Such an array is written with each set of keys once, followed by the
+  // values of each object, instead of with the keys of every object. This
+  // doesn't run script, so that V8 can still write |value| otherwise.
+  v8::Maybe<bool> PrepareShapedObjectArray(v8::Local<v8::Value> value,
+                                           ShapedObjectArray* result);
+  v8::Maybe<bool> WriteShapedObjectArray(const ShapedObjectArray&);
+
   // Shared between File and FileList logic; does not write a leading tag.
   bool WriteFile(File*, ExceptionState&);
 
@@ -119,6 +136,9 @@ class CORE_EXPORT V8ScriptValueSerializer
   SharedArrayBufferArray shared_array_buffers_;
   Options::WasmSerializationPolicy wasm_policy_;
   bool for_storage_ = false;
+  bool clone_array_buffers_out_of_band_ = false;
+  DOMArrayBuffer* out_of_band_array_buffer_ = nullptr;
+  bool write_shaped_object_arrays_ = false;
 #if DCHECK_IS_ON()
   bool serialize_invoked_ = false;
 #endif
@@ -4,15 +4,18 @@
 
 #include "third_party/blink/renderer/bindings/core/v8/serialization/v8_script_value_serializer.h"
 
+#include "base/test/scoped_feature_list.h"
 #include "base/time/time.h"
 #include "build/build_config.h"
 #include "testing/gmock/include/gmock/gmock.h"
 #include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/public/common/features.h"
 #include "third_party/blink/public/platform/web_blob_info.h"
 #include "third_party/blink/renderer/bindings/core/v8/script_controller.h"
 #include "third_party/blink/renderer/bindings/core/v8/script_source_code.h"
 #include "third_party/blink/renderer/bindings/core/v8/serialization/unpacked_serialized_script_value.h"
 #include "third_party/blink/renderer/bindings/core/v8/serialization/v8_script_value_deserializer.h"
+#include "third_party/blink/renderer/bindings/core/v8/v8_array_buffer.h"
 #include "third_party/blink/renderer/bindings/core/v8/v8_binding_for_testing.h"
 #include "third_party/blink/renderer/bindings/core/v8/v8_blob.h"
 #include "third_party/blink/renderer/bindings/core/v8/v8_dom_exception.h"
@@ -50,6 +53,7 @@
 #include "third_party/blink/renderer/core/mojo/mojo_handle.h"
 #include "third_party/blink/renderer/core/offscreencanvas/offscreen_canvas.h"
 #include "third_party/blink/renderer/core/streams/readable_stream.h"
+#include "third_party/blink/renderer/core/typed_arrays/dom_shared_array_buffer.h"
 #include "third_party/blink/renderer/platform/bindings/exception_state.h"
 #include "third_party/blink/renderer/platform/file_metadata.h"
 #include "third_party/blink/renderer/platform/graphics/unaccelerated_static_bitmap_image.h"
@@ -233,6 +237,214 @@ TEST(V8ScriptValueSerializerTest, DetachHappensAfterSerialization) {
   EXPECT_FALSE(array_buffer->IsDetached());
 }
 
+TEST(V8ScriptValueSerializerTest, CloneArrayBufferOutOfBand) {
+  // Large array buffers are copied next to the wire data, and the
+  // deserialized array buffer adopts the copy.
+  V8TestingScope scope;
+  ScriptState* script_state = scope.GetScriptState();
+  constexpr size_t kSize = 1024 * 1024;
+  DOMArrayBuffer* array_buffer = DOMArrayBuffer::Create(kSize, 1);
+  static_cast<uint8_t*>(array_buffer->Data())[kSize - 1] = 42;
+  v8::Local<v8::Value> wrapper =
+      ToV8(array_buffer, scope.GetContext()->Global(), scope.GetIsolate());
+
+  V8ScriptValueSerializer::Options serialize_options;
+  serialize_options.clone_array_buffers_out_of_band = true;
+  scoped_refptr<SerializedScriptValue> serialized_script_value =
+      V8ScriptValueSerializer(script_state, serialize_options)
+          .Serialize(wrapper, ASSERT_NO_EXCEPTION);
+  ASSERT_TRUE(serialized_script_value);
+  EXPECT_EQ(1u, serialized_script_value->GetArrayBufferContentsArray().size());
+  EXPECT_LT(serialized_script_value->DataLengthInBytes(), 64u);
+  // The array buffer is cloned, not transferred.
+  EXPECT_FALSE(array_buffer->IsDetached());
+
+  UnpackedSerializedScriptValue* unpacked =
+      SerializedScriptValue::Unpack(std::move(serialized_script_value));
+  v8::Local<v8::Value> result =
+      V8ScriptValueDeserializer(script_state, unpacked).Deserialize();
+  ASSERT_TRUE(result->IsArrayBuffer());
+  DOMArrayBuffer* new_array_buffer =
+      V8ArrayBuffer::ToImpl(result.As<v8::Object>());
+  EXPECT_NE(array_buffer, new_array_buffer);
+  ASSERT_EQ(kSize, new_array_buffer->ByteLengthAsSizeT());
+  EXPECT_EQ(42, static_cast<uint8_t*>(new_array_buffer->Data())[kSize - 1]);
+  EXPECT_NE(array_buffer->Data(), new_array_buffer->Data());
+}
+
+TEST(V8ScriptValueSerializerTest, CloneSmallArrayBufferInBand) {
+  V8TestingScope scope;
+  DOMArrayBuffer* array_buffer = DOMArrayBuffer::Create(16, 1);
+  v8::Local<v8::Value> wrapper =
+      ToV8(array_buffer, scope.GetContext()->Global(), scope.GetIsolate());
+
+  V8ScriptValueSerializer::Options serialize_options;
+  serialize_options.clone_array_buffers_out_of_band = true;
+  scoped_refptr<SerializedScriptValue> serialized_script_value =
+      V8ScriptValueSerializer(scope.GetScriptState(), serialize_options)
+          .Serialize(wrapper, ASSERT_NO_EXCEPTION);
+  ASSERT_TRUE(serialized_script_value);
+  EXPECT_TRUE(serialized_script_value->GetArrayBufferContentsArray().IsEmpty());
+}
+
+TEST(V8ScriptValueSerializerTest, ViewOnLargeSharedArrayBufferStaysShared) {
+  // Only array buffers are cloned out of band. A large SharedArrayBuffer
+  // behind a view is still shared.
+  V8TestingScope scope;
+  constexpr size_t kSize = 1024 * 1024;
+  DOMSharedArrayBuffer* shared_array_buffer =
+      DOMSharedArrayBuffer::Create(kSize, 1);
+  v8::Local<v8::Value> wrapper = ToV8(
+      shared_array_buffer, scope.GetContext()->Global(), scope.GetIsolate());
+  v8::Local<v8::Uint8Array> view =
+      v8::Uint8Array::New(wrapper.As<v8::SharedArrayBuffer>(), 0, kSize);
+
+  V8ScriptValueSerializer::Options serialize_options;
+  serialize_options.clone_array_buffers_out_of_band = true;
+  scoped_refptr<SerializedScriptValue> serialized_script_value =
+      V8ScriptValueSerializer(scope.GetScriptState(), serialize_options)
+          .Serialize(view, ASSERT_NO_EXCEPTION);
+  ASSERT_TRUE(serialized_script_value);
+  EXPECT_TRUE(serialized_script_value->GetArrayBufferContentsArray().IsEmpty());
+  EXPECT_EQ(1u, serialized_script_value->SharedArrayBuffersContents().size());
+}
+
+TEST(V8ScriptValueSerializerTest, RoundTripShapedObjectArray) {
+  // Arrays of objects sharing their property keys are written with a shape
+  // table, and come back with the same properties in the same order.
+  base::test::ScopedFeatureList feature_list;
+  feature_list.InitAndEnableFeature(features::kShapedObjectArraySerialization);
+  V8TestingScope scope;
+  v8::Local<v8::Value> array = Eval(
+      "Array.from({length: 20}, (_, i) => i % 3 ?"
+      "    {id: i, name: 'item' + i, done: i % 2 == 0, 7: null} :"
+      "    {id: i, parent: i > 0 ? i - 1 : undefined})",
+      scope);
+  ASSERT_TRUE(array->IsArray());
+
+  scoped_refptr<SerializedScriptValue> serialized_script_value =
+      V8ScriptValueSerializer(scope.GetScriptState())
+          .Serialize(array, ASSERT_NO_EXCEPTION);
+  ASSERT_TRUE(serialized_script_value);
+  ASSERT_GT(serialized_script_value->DataLengthInBytes(), 3u);
+  EXPECT_EQ(kShapedObjectArrayTag, serialized_script_value->Data()[2]);
+
+  v8::Local<v8::Value> result = RoundTrip(array, scope);
+  ASSERT_TRUE(result->IsArray());
+  EXPECT_EQ(ToJSON(array.As<v8::Object>(), scope),
+            ToJSON(result.As<v8::Object>(), scope));
+  // JSON leaves out undefined values.
+  v8::Local<v8::Object> first = result.As<v8::Array>()
+                                    ->Get(scope.GetContext(), 0)
+                                    .ToLocalChecked()
+                                    .As<v8::Object>();
+  EXPECT_TRUE(first
+                  ->HasOwnProperty(scope.GetContext(),
+                                   V8String(scope.GetIsolate(), "parent"))
+                  .ToChecked());
+}
+
+TEST(V8ScriptValueSerializerTest, WriteLargeShapedObjectArray) {
+  // Identity hashes of thousands of objects collide, which must not be
+  // mistaken for the same object occurring twice.
+  base::test::ScopedFeatureList feature_list;
+  feature_list.InitAndEnableFeature(features::kShapedObjectArraySerialization);
+  V8TestingScope scope;
+  v8::Local<v8::Value> array =
+      Eval("Array.from({length: 5000}, (_, i) => ({id: i}))", scope);
+  scoped_refptr<SerializedScriptValue> serialized_script_value =
+      V8ScriptValueSerializer(scope.GetScriptState())
+          .Serialize(array, ASSERT_NO_EXCEPTION);
+  ASSERT_TRUE(serialized_script_value);
+  EXPECT_EQ(kShapedObjectArrayTag, serialized_script_value->Data()[2]);
+}
+
+TEST(V8ScriptValueSerializerTest, WriteArrayWithoutShapeTable) {
+  base::test::ScopedFeatureList feature_list;
+  feature_list.InitAndEnableFeature(features::kShapedObjectArraySerialization);
+  V8TestingScope scope;
+  const char* const kSources[] = {
+      // Too short.
+      "[{a: 1}, {a: 2}]",
+      // Nested objects.
+      "Array.from({length: 20}, (_, i) => ({a: {b: i}}))",
+      // Holes and other elements.
+      "var a = Array.from({length: 20}, (_, i) => ({a: i})); delete a[3]; a",
+      "Array.from({length: 20}, (_, i) => i ? {a: i} : i)",
+      // Named properties of the array.
+      "var a = Array.from({length: 20}, (_, i) => ({a: i})); a.b = 1; a",
+      "var a = Array.from({length: 20}, (_, i) => ({a: i}));"
+      "delete a[3]; a.b = 1; a",
+      // Objects that are not ordinary.
+      "Array.from({length: 20}, (_, i) => new Date(i))",
+      // Too many shapes.
+      "Array.from({length: 20}, (_, i) => ({['a' + i]: i}))",
+      // Accessors, which would run script.
+      "var a = Array.from({length: 20}, (_, i) => ({a: i}));"
+      "Object.defineProperty(a, 3, {get() { return {a: 3}; },"
+      "                             enumerable: true}); a",
+      "Array.from({length: 20}, (_, i) => ({get a() { return i; }}))",
+      // The same object more than once.
+      "var a = Array.from({length: 20}, (_, i) => ({a: i})); a[3] = a[2]; a",
+  };
+  for (const char* source : kSources) {
+    SCOPED_TRACE(source);
+    v8::Local<v8::Value> array = Eval(source, scope);
+    scoped_refptr<SerializedScriptValue> serialized_script_value =
+        V8ScriptValueSerializer(scope.GetScriptState())
+            .Serialize(array, ASSERT_NO_EXCEPTION);
+    ASSERT_TRUE(serialized_script_value);
+    EXPECT_EQ(kVersionTag, serialized_script_value->Data()[2]);
+    v8::Local<v8::Value> result = RoundTrip(array, scope);
+    EXPECT_EQ(ToJSON(array.As<v8::Object>(), scope),
+              ToJSON(result.As<v8::Object>(), scope));
+  }
+}
+
+TEST(V8ScriptValueSerializerTest, ShapedObjectArrayGettersRunOnce) {
+  base::test::ScopedFeatureList feature_list;
+  feature_list.InitAndEnableFeature(features::kShapedObjectArraySerialization);
+  V8TestingScope scope;
+  v8::Local<v8::Value> array = Eval(
+      "var getterCalls = 0;"
+      "var a = Array.from({length: 20}, (_, i) => ({a: i}));"
+      "Object.defineProperty(a[19], 'b', {"
+      "  get() { if (getterCalls++ == 0) throw 'first'; return 1; },"
+      "  enumerable: true}); a",
+      scope);
+  ExceptionState exception_state(scope.GetIsolate(),
+                                 ExceptionState::kExecutionContext, "Window",
+                                 "postMessage");
+  EXPECT_FALSE(V8ScriptValueSerializer(scope.GetScriptState())
+                   .Serialize(array, exception_state));
+  EXPECT_TRUE(exception_state.HadException());
+  EXPECT_EQ(1, Eval("getterCalls", scope)
+                   ->Int32Value(scope.GetContext())
+                   .ToChecked());
+}
+
+TEST(V8ScriptValueSerializerTest, DecodeTruncatedShapedObjectArray) {
+  base::test::ScopedFeatureList feature_list;
+  feature_list.InitAndEnableFeature(features::kShapedObjectArraySerialization);
+  V8TestingScope scope;
+  v8::Local<v8::Value> array =
+      Eval("Array.from({length: 16}, (_, i) => ({a: i, b: 'b'}))", scope);
+  scoped_refptr<SerializedScriptValue> serialized_script_value =
+      V8ScriptValueSerializer(scope.GetScriptState())
+          .Serialize(array, ASSERT_NO_EXCEPTION);
+  ASSERT_TRUE(serialized_script_value);
+  const char* data =
+      reinterpret_cast<const char*>(serialized_script_value->Data());
+  for (size_t size = 3; size < serialized_script_value->DataLengthInBytes();
+       ++size) {
+    scoped_refptr<SerializedScriptValue> input =
+        SerializedScriptValue::Create(data, size);
+    EXPECT_TRUE(V8ScriptValueDeserializer(scope.GetScriptState(), input)
+                    .Deserialize()
+                    ->IsNull());
+  }
+}
+
 TEST(V8ScriptValueSerializerTest, RoundTripDOMPoint) {
   // DOMPoint objects should serialize and deserialize correctly.
   V8TestingScope scope;
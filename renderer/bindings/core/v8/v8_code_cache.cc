@@ -24,9 +24,14 @@ namespace blink {
 
 namespace {
 
-enum CacheTagKind { kCacheTagCode = 0, kCacheTagTimeStamp = 1, kCacheTagLast };
+enum CacheTagKind {
+  kCacheTagCode = 0,
+  kCacheTagTimeStamp = 1,
+  kCacheTagModuleGraph = 2,
+  kCacheTagLast
+};
 
-static const int kCacheTagKindSize = 1;
+static const int kCacheTagKindSize = 2;
 
 static_assert((1 << kCacheTagKindSize) >= kCacheTagLast,
               "CacheTagLast must be large enough");
@@ -72,6 +77,16 @@ bool V8CodeCache::HasCodeCache(
   return cache_handler->GetCachedMetadata(code_cache_tag).get();
 }
 
+bool V8CodeCache::HasModuleGraphCodeCache(
+    const SingleCachedMetadataHandler* cache_handler) {
+  if (!cache_handler)
+    return false;
+
+  uint32_t module_graph_tag =
+      V8CodeCache::TagForModuleGraphCodeCache(cache_handler);
+  return cache_handler->GetCachedMetadata(module_graph_tag).get();
+}
+
 v8::ScriptCompiler::CachedData* V8CodeCache::CreateCachedData(
     const SingleCachedMetadataHandler* cache_handler) {
   DCHECK(cache_handler);
@@ -291,6 +306,11 @@ uint32_t V8CodeCache::TagForTimeStamp(
   return CacheTag(kCacheTagTimeStamp, cache_handler->Encoding());
 }
 
+uint32_t V8CodeCache::TagForModuleGraphCodeCache(
+    const SingleCachedMetadataHandler* cache_handler) {
+  return CacheTag(kCacheTagModuleGraph, cache_handler->Encoding());
+}
+
 // Store a timestamp to the cache as hint.
 void V8CodeCache::SetCacheTimeStamp(
     SingleCachedMetadataHandler* cache_handler) {
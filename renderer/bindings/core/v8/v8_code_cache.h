@@ -46,11 +46,18 @@ class CORE_EXPORT V8CodeCache final {
 
   static uint32_t TagForCodeCache(const SingleCachedMetadataHandler*);
   static uint32_t TagForTimeStamp(const SingleCachedMetadataHandler*);
+  // The tag of the CachedMetadata that holds the code caches of a module
+  // graph, see ModuleGraphCodeCache.
+  static uint32_t TagForModuleGraphCodeCache(
+      const SingleCachedMetadataHandler*);
   static void SetCacheTimeStamp(SingleCachedMetadataHandler*);
 
   // Returns true iff the SingleCachedMetadataHandler contains a code cache
   // that can be consumed by V8.
   static bool HasCodeCache(const SingleCachedMetadataHandler*);
+  // Returns true iff the SingleCachedMetadataHandler contains the code caches
+  // of a module graph.
+  static bool HasModuleGraphCodeCache(const SingleCachedMetadataHandler*);
 
   static std::tuple<v8::ScriptCompiler::CompileOptions,
                     ProduceCacheOptions,
@@ -170,7 +170,8 @@ v8::Local<FunctionOrTemplate> CreateAccessorFunctionOrTemplate(
     v8::Local<v8::Signature>,
     const char* name,
     AccessorType,
-    v8::SideEffectType side_effect_type = v8::SideEffectType::kHasSideEffect);
+    v8::SideEffectType side_effect_type = v8::SideEffectType::kHasSideEffect,
+    const v8::CFunction* c_function = nullptr);
 
 template <>
 v8::Local<v8::FunctionTemplate>
@@ -182,7 +183,8 @@ CreateAccessorFunctionOrTemplate<v8::FunctionTemplate>(
     v8::Local<v8::Signature> signature,
     const char* name,
     AccessorType type,
-    v8::SideEffectType side_effect_type) {
+    v8::SideEffectType side_effect_type,
+    const v8::CFunction* c_function) {
   v8::Local<v8::FunctionTemplate> function_template;
   if (callback) {
     // https://heycam.github.io/webidl/#dfn-attribute-getter has:
@@ -195,6 +197,7 @@ CreateAccessorFunctionOrTemplate<v8::FunctionTemplate>(
     int length = type == AccessorType::Getter ? 0 : 1;
 
     if (cached_property_key != V8PrivateProperty::CachedAccessor::kNone) {
+      DCHECK(!c_function);
       function_template = v8::FunctionTemplate::NewWithCache(
           isolate, callback,
           V8PrivateProperty::GetCachedAccessor(isolate, cached_property_key)
@@ -203,7 +206,7 @@ CreateAccessorFunctionOrTemplate<v8::FunctionTemplate>(
     } else {
       function_template = v8::FunctionTemplate::New(
           isolate, callback, data, signature, length,
-          v8::ConstructorBehavior::kAllow, side_effect_type);
+          v8::ConstructorBehavior::kAllow, side_effect_type, c_function);
     }
 
     if (!function_template.IsEmpty()) {
@@ -245,14 +248,15 @@ v8::Local<v8::Function> CreateAccessorFunctionOrTemplate<v8::Function>(
     v8::Local<v8::Signature> signature,
     const char* name,
     AccessorType type,
-    v8::SideEffectType side_effect_type) {
+    v8::SideEffectType side_effect_type,
+    const v8::CFunction* c_function) {
   if (!callback)
     return v8::Local<v8::Function>();
 
   v8::Local<v8::FunctionTemplate> function_template =
       CreateAccessorFunctionOrTemplate<v8::FunctionTemplate>(
           isolate, callback, V8PrivateProperty::CachedAccessor::kNone, data,
-          signature, name, type, side_effect_type);
+          signature, name, type, side_effect_type, c_function);
   if (function_template.IsEmpty())
     return v8::Local<v8::Function>();
 
@@ -325,11 +329,15 @@ void InstallAccessorInternal(
   DCHECK(location);
   if (location &
       (V8DOMConfiguration::kOnInstance | V8DOMConfiguration::kOnPrototype)) {
+    v8::CFunction getter_c_function;
+    if (config.getter_fast_callback)
+      getter_c_function = config.getter_fast_callback();
     v8::Local<FunctionOrTemplate> getter =
         CreateAccessorFunctionOrTemplate<FunctionOrTemplate>(
             isolate, getter_callback, cached_property_key,
             v8::Local<v8::Value>(), signature, config.name,
-            AccessorType::Getter, getter_side_effect_type);
+            AccessorType::Getter, getter_side_effect_type,
+            config.getter_fast_callback ? &getter_c_function : nullptr);
     v8::Local<FunctionOrTemplate> setter =
         CreateAccessorFunctionOrTemplate<FunctionOrTemplate>(
             isolate, setter_callback, V8PrivateProperty::CachedAccessor::kNone,
@@ -446,6 +454,23 @@ void AddMethodToTemplate(
                    static_cast<v8::PropertyAttribute>(method.attribute));
 }
 
+// Returns the [NoAllocDirectCall] fast callback of |method| in |c_function|,
+// or null if it has none.
+const v8::CFunction* GetFastCallback(
+    const V8DOMConfiguration::MethodConfiguration& method,
+    v8::CFunction* c_function) {
+  if (!method.fast_callback)
+    return nullptr;
+  *c_function = method.fast_callback();
+  return c_function;
+}
+
+const v8::CFunction* GetFastCallback(
+    const V8DOMConfiguration::SymbolKeyedMethodConfiguration&,
+    v8::CFunction*) {
+  return nullptr;
+}
+
 template <class Configuration>
 void InstallMethodInternal(v8::Isolate* isolate,
                            v8::Local<v8::ObjectTemplate> instance_template,
@@ -474,11 +499,13 @@ void InstallMethodInternal(v8::Isolate* isolate,
           : v8::SideEffectType::kHasSideEffect;
   if (method.property_location_configuration &
       (V8DOMConfiguration::kOnInstance | V8DOMConfiguration::kOnPrototype)) {
+    v8::CFunction c_function;
     // TODO(luoe): use ConstructorBehavior::kThrow for non-constructor methods.
     v8::Local<v8::FunctionTemplate> function_template =
         v8::FunctionTemplate::New(
             isolate, callback, v8::Local<v8::Value>(), signature, method.length,
-            v8::ConstructorBehavior::kAllow, side_effect_type);
+            v8::ConstructorBehavior::kAllow, side_effect_type,
+            GetFastCallback(method, &c_function));
     function_template->RemovePrototype();
     if (method.access_check_configuration == V8DOMConfiguration::kCheckAccess)
       function_template->SetAcceptAnyReceiver(false);
@@ -542,11 +569,13 @@ void InstallMethodInternal(
   DCHECK(location);
   if (location &
       (V8DOMConfiguration::kOnInstance | V8DOMConfiguration::kOnPrototype)) {
+    v8::CFunction c_function;
     // TODO(luoe): use ConstructorBehavior::kThrow for non-constructor methods.
     v8::Local<v8::FunctionTemplate> function_template =
         v8::FunctionTemplate::New(
             isolate, callback, v8::Local<v8::Value>(), signature, config.length,
-            v8::ConstructorBehavior::kAllow, side_effect_type);
+            v8::ConstructorBehavior::kAllow, side_effect_type,
+            GetFastCallback(config, &c_function));
     function_template->RemovePrototype();
     if (config.access_check_configuration == V8DOMConfiguration::kCheckAccess) {
       function_template->SetAcceptAnyReceiver(false);
@@ -34,6 +34,7 @@
 #include "third_party/blink/renderer/core/core_export.h"
 #include "third_party/blink/renderer/platform/bindings/v8_dom_wrapper.h"
 #include "third_party/blink/renderer/platform/bindings/v8_private_property.h"
+#include "v8/include/v8-fast-api-calls.h"
 #include "v8/include/v8.h"
 
 namespace blink {
@@ -86,6 +87,11 @@ class CORE_EXPORT V8DOMConfiguration final {
     kAllWorlds = kMainWorld | kNonMainWorlds,
   };
 
+  // Returns the V8 Fast API callback of a [NoAllocDirectCall] attribute getter
+  // or operation, which optimized code may call instead of the regular
+  // callback.
+  using FastCallbackFactory = v8::CFunction (*)();
+
   // AttributeConfiguration translates into calls to SetNativeDataProperty() on
   // either of instance or prototype object (or their object template).
   struct AttributeConfiguration {
@@ -159,6 +165,8 @@ class CORE_EXPORT V8DOMConfiguration final {
     unsigned getter_behavior : 1;
     // WorldConfiguration
     unsigned world_configuration : 2;
+    // [NoAllocDirectCall]
+    FastCallbackFactory getter_fast_callback;
   };
 
   static void InstallAccessors(
@@ -316,6 +324,8 @@ class CORE_EXPORT V8DOMConfiguration final {
     unsigned side_effect_type : 1;
     // WorldConfiguration
     unsigned world_configuration : 2;
+    // [NoAllocDirectCall]
+    FastCallbackFactory fast_callback;
   };
 
   struct SymbolKeyedMethodConfiguration {
@@ -28,6 +28,7 @@
 #include "base/feature_list.h"
 #include "build/build_config.h"
 #include "third_party/blink/public/common/features.h"
+#include "third_party/blink/public/mojom/script/script_type.mojom-blink.h"
 #include "third_party/blink/renderer/bindings/core/v8/binding_security.h"
 #include "third_party/blink/renderer/bindings/core/v8/referrer_script_info.h"
 #include "third_party/blink/renderer/bindings/core/v8/script_source_code.h"
@@ -250,7 +251,10 @@ v8::MaybeLocal<v8::Module> V8ScriptRunner::CompileModule(
     const TextPosition& start_position,
     v8::ScriptCompiler::CompileOptions compile_options,
     v8::ScriptCompiler::NoCacheReason no_cache_reason,
-    const ReferrerScriptInfo& referrer_info) {
+    const ReferrerScriptInfo& referrer_info,
+    v8::ScriptCompiler::CachedData* module_graph_code_cache,
+    ScriptStreamer* streamer,
+    ScriptStreamer::NotStreamingReason not_streaming_reason) {
   constexpr const char* kTraceEventCategoryGroup = "v8,devtools.timeline";
   TRACE_EVENT_BEGIN1(kTraceEventCategoryGroup, "v8.compileModule", "fileName",
                      file_name.Utf8());
@@ -274,43 +278,65 @@ v8::MaybeLocal<v8::Module> V8ScriptRunner::CompileModule(
   v8::MaybeLocal<v8::Module> script;
   inspector_compile_script_event::V8CacheResult cache_result;
 
-  switch (compile_options) {
-    case v8::ScriptCompiler::kNoCompileOptions:
-    case v8::ScriptCompiler::kEagerCompile: {
-      v8::ScriptCompiler::Source source(code, origin);
-      script = v8::ScriptCompiler::CompileModule(
-          isolate, &source, compile_options, no_cache_reason);
-      break;
-    }
+  if (streamer) {
+    // Final compile call for a streamed module compilation.
+    DCHECK(streamer->IsFinished());
+    DCHECK(!streamer->StreamingSuppressed());
+    DCHECK_EQ(streamer->GetScriptType(), mojom::ScriptType::kModule);
+    DCHECK(!module_graph_code_cache);
+    script = v8::ScriptCompiler::CompileModule(
+        isolate->GetCurrentContext(), streamer->Source(), code, origin);
+  } else {
+    switch (compile_options) {
+      case v8::ScriptCompiler::kNoCompileOptions:
+      case v8::ScriptCompiler::kEagerCompile: {
+        v8::ScriptCompiler::Source source(code, origin);
+        script = v8::ScriptCompiler::CompileModule(
+            isolate, &source, compile_options, no_cache_reason);
+        break;
+      }
 
-    case v8::ScriptCompiler::kConsumeCodeCache: {
-      // Compile a script, and consume a V8 cache that was generated previously.
-      DCHECK(cache_handler);
-      v8::ScriptCompiler::CachedData* cached_data =
-          V8CodeCache::CreateCachedData(cache_handler);
-      v8::ScriptCompiler::Source source(code, origin, cached_data);
-      script = v8::ScriptCompiler::CompileModule(
-          isolate, &source, compile_options, no_cache_reason);
-      if (cached_data->rejected) {
-        cache_handler->ClearCachedMetadata(
-            CachedMetadataHandler::kClearPersistentStorage);
-      } else if (InDiscardExperiment()) {
-        // Experimentally free code cache from memory after first use. See
-        // http://crbug.com/1045052.
-        cache_handler->ClearCachedMetadata(
-            CachedMetadataHandler::kDiscardLocally);
+      case v8::ScriptCompiler::kConsumeCodeCache: {
+        // Compile a script, and consume a V8 cache that was generated
+        // previously.
+        v8::ScriptCompiler::CachedData* cached_data;
+        if (module_graph_code_cache) {
+          cached_data = new v8::ScriptCompiler::CachedData(
+              module_graph_code_cache->data, module_graph_code_cache->length,
+              v8::ScriptCompiler::CachedData::BufferNotOwned);
+        } else {
+          DCHECK(cache_handler);
+          cached_data = V8CodeCache::CreateCachedData(cache_handler);
+        }
+        v8::ScriptCompiler::Source source(code, origin, cached_data);
+        script = v8::ScriptCompiler::CompileModule(
+            isolate, &source, compile_options, no_cache_reason);
+        if (module_graph_code_cache) {
+          // The code cache belongs to the CachedMetadata of the root module
+          // script of a module graph, not to |cache_handler|, so leave the
+          // latter alone.
+          module_graph_code_cache->rejected = cached_data->rejected;
+        } else if (cached_data->rejected) {
+          cache_handler->ClearCachedMetadata(
+              CachedMetadataHandler::kClearPersistentStorage);
+        } else if (InDiscardExperiment()) {
+          // Experimentally free code cache from memory after first use. See
+          // http://crbug.com/1045052.
+          cache_handler->ClearCachedMetadata(
+              CachedMetadataHandler::kDiscardLocally);
+        }
+        cache_result.consume_result = base::make_optional(
+            inspector_compile_script_event::V8CacheResult::ConsumeResult(
+                compile_options, cached_data->length, cached_data->rejected));
+        break;
       }
-      cache_result.consume_result = base::make_optional(
-          inspector_compile_script_event::V8CacheResult::ConsumeResult(
-              compile_options, cached_data->length, cached_data->rejected));
-      break;
     }
   }
 
   TRACE_EVENT_END1(kTraceEventCategoryGroup, "v8.compileModule", "data",
                    inspector_compile_script_event::Data(
-                       file_name, start_position, cache_result, false,
-                       ScriptStreamer::kModuleScript));
+                       file_name, start_position, cache_result, streamer,
+                       not_streaming_reason));
 
   return script;
 }
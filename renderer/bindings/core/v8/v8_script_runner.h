@@ -27,6 +27,7 @@
 #define THIRD_PARTY_BLINK_RENDERER_BINDINGS_CORE_V8_V8_SCRIPT_RUNNER_H_
 
 #include "third_party/blink/renderer/bindings/core/v8/sanitize_script_errors.h"
+#include "third_party/blink/renderer/bindings/core/v8/script_streamer.h"
 #include "third_party/blink/renderer/core/core_export.h"
 #include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
 #include "third_party/blink/renderer/platform/wtf/forward.h"
@@ -57,6 +58,14 @@ class CORE_EXPORT V8ScriptRunner final {
       v8::ScriptCompiler::CompileOptions,
       v8::ScriptCompiler::NoCacheReason,
       const ReferrerScriptInfo&);
+  // With kConsumeCodeCache, consumes |module_graph_code_cache| if it is not
+  // null and the code cache of the SingleCachedMetadataHandler otherwise.
+  // |module_graph_code_cache| is owned by the caller, which can check whether
+  // V8 rejected it.
+  //
+  // If |streamer| is not null, the module script was parsed while it was
+  // streamed and the compile options are ignored. Otherwise,
+  // |not_streaming_reason| says why it wasn't streamed.
   static v8::MaybeLocal<v8::Module> CompileModule(
       v8::Isolate*,
       const String& source,
@@ -65,7 +74,10 @@ class CORE_EXPORT V8ScriptRunner final {
       const WTF::TextPosition&,
       v8::ScriptCompiler::CompileOptions,
       v8::ScriptCompiler::NoCacheReason,
-      const ReferrerScriptInfo&);
+      const ReferrerScriptInfo&,
+      v8::ScriptCompiler::CachedData* module_graph_code_cache,
+      ScriptStreamer* streamer,
+      ScriptStreamer::NotStreamingReason not_streaming_reason);
   static v8::MaybeLocal<v8::Value> RunCompiledScript(v8::Isolate*,
                                                      v8::Local<v8::Script>,
                                                      ExecutionContext*);
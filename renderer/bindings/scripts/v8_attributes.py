@@ -132,6 +132,14 @@ def attribute_context(interface, attribute, interfaces, component_info):
     # [CachedAccessor]
     is_cached_accessor = 'CachedAccessor' in extended_attributes
 
+    # [NoAllocDirectCall]
+    no_alloc_direct_call_return_type = (
+        v8_utilities.no_alloc_direct_call_return_type(attribute, interface))
+    if (no_alloc_direct_call_return_type
+            and is_data_type_property(interface, attribute)):
+        raise Exception('[NoAllocDirectCall] is not supported for %s.%s' %
+                        (interface.name, attribute.name))
+
     # [LenientSetter]
     is_lenient_setter = 'LenientSetter' in extended_attributes
 
@@ -251,6 +259,7 @@ def attribute_context(interface, attribute, interfaces, component_info):
         'is_nullable': idl_type.is_nullable,
         'is_explicit_nullable': idl_type.is_explicit_nullable,
         'is_named_constructor': is_named_constructor_attribute(attribute),
+        'is_no_alloc_direct_call': bool(no_alloc_direct_call_return_type),
         'is_partial_interface_member':
             'PartialInterfaceImplementedAs' in extended_attributes,
         'is_per_world_bindings': 'PerWorldBindings' in extended_attributes,
@@ -264,6 +273,7 @@ def attribute_context(interface, attribute, interfaces, component_info):
         'is_unforgeable': is_unforgeable(attribute),
         'measure_as': measure_as,
         'name': attribute.name,
+        'no_alloc_direct_call_return_type': no_alloc_direct_call_return_type,
         'on_instance': v8_utilities.on_instance(interface, attribute),
         'on_interface': v8_utilities.on_interface(interface, attribute),
         'on_prototype': v8_utilities.on_prototype(interface, attribute),
@@ -1103,6 +1103,12 @@ def overloads_context(interface, overloads):
             'overloaded methods: %s.%s' % (interface.name,
                                            overloads[0]['name']))
 
+    # [NoAllocDirectCall]
+    if any(method.get('is_no_alloc_direct_call') for method in overloads):
+        raise Exception(
+            '[NoAllocDirectCall] cannot be specified on overloaded methods: '
+            '%s.%s' % (interface.name, overloads[0]['name']))
+
     effective_overloads_by_length = effective_overload_set_by_length(overloads)
     lengths = [length for length, _ in effective_overloads_by_length]
     name = overloads[0].get('name', '<constructor>')
@@ -200,6 +200,10 @@ def method_context(interface, method, component_info, is_visible=True):
     if 'LogActivity' in extended_attributes:
         includes.add('platform/bindings/v8_per_context_data.h')
 
+    # [NoAllocDirectCall]
+    no_alloc_direct_call_return_type = (
+        v8_utilities.no_alloc_direct_call_return_type(method, interface))
+
     argument_contexts = [
         argument_context(
             interface, method, argument, index, is_visible=is_visible)
@@ -262,6 +266,8 @@ def method_context(interface, method, component_info, is_visible=True):
         idl_type.is_explicit_nullable,
         'is_new_object':
         'NewObject' in extended_attributes,
+        'is_no_alloc_direct_call':
+        bool(no_alloc_direct_call_return_type),
         'is_partial_interface_member':
         'PartialInterfaceImplementedAs' in extended_attributes,
         'is_per_world_bindings':
@@ -278,6 +284,8 @@ def method_context(interface, method, component_info, is_visible=True):
         v8_utilities.measure_as(method, interface),  # [MeasureAs]
         'name':
         name,
+        'no_alloc_direct_call_return_type':
+        no_alloc_direct_call_return_type,
         'number_of_arguments':
         len(arguments),
         'number_of_required_arguments':
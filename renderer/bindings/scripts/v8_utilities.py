@@ -457,6 +457,70 @@ def high_entropy(definition_or_member):
     return False
 
 
+# [NoAllocDirectCall]
+# The C++ types that V8 Fast API calls pass, for the IDL types they support.
+NO_ALLOC_DIRECT_CALL_RETURN_TYPES = {
+    'boolean': 'bool',
+    'byte': 'int32_t',
+    'octet': 'uint32_t',
+    'short': 'int32_t',
+    'unsigned short': 'uint32_t',
+    'long': 'int32_t',
+    'unsigned long': 'uint32_t',
+    'float': 'float',
+    'unrestricted float': 'float',
+    'double': 'double',
+    'unrestricted double': 'double',
+}
+
+# Extended attributes which need the isolate, the holder or the script state
+# of the call, none of which a V8 Fast API callback has.
+NO_ALLOC_DIRECT_CALL_INCOMPATIBLE_EXTENDED_ATTRIBUTES = [
+    'CachedAccessor',
+    'CachedAttribute',
+    'CallWith',
+    'CEReactions',
+    'CheckSecurity',
+    'CrossOrigin',
+    'Custom',
+    'CustomElementCallbacks',
+    'DeprecateAs',
+    'HighEntropy',
+    'LenientThis',
+    'LogActivity',
+    'Measure',
+    'MeasureAs',
+    'PerWorldBindings',
+    'RaisesException',
+    'Reflect',
+    'RuntimeCallStatsCounter',
+    'SaveSameObject',
+]
+
+
+def no_alloc_direct_call_return_type(member, interface):
+    """Returns the C++ return type of the V8 Fast API callback of |member|, or
+    None if |member| is not [NoAllocDirectCall].
+
+    A V8 Fast API callback is called directly from optimized code, and must
+    neither allocate on the V8 heap, call into JavaScript nor throw, so only
+    side-effect free attribute getters and operations without arguments that
+    return primitive types are supported.
+    """
+    if 'NoAllocDirectCall' not in member.extended_attributes:
+        return None
+    idl_type = member.idl_type
+    arguments = getattr(member, 'arguments', [])
+    if (member.is_static or idl_type.is_nullable or arguments
+            or idl_type.base_type not in NO_ALLOC_DIRECT_CALL_RETURN_TYPES
+            or not has_extended_attribute_value(member, 'Affects', 'Nothing')
+            or has_extended_attribute(
+                member, NO_ALLOC_DIRECT_CALL_INCOMPATIBLE_EXTENDED_ATTRIBUTES)):
+        raise Exception('[NoAllocDirectCall] is not supported for %s.%s' %
+                        (interface.name, member.name))
+    return NO_ALLOC_DIRECT_CALL_RETURN_TYPES[idl_type.base_type]
+
+
 # [RuntimeEnabled]
 def _is_origin_trial_feature(feature_name, runtime_features):
     assert feature_name in runtime_features, feature_name + ' is not a runtime feature.'
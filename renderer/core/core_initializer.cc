@@ -30,6 +30,8 @@
 
 #include "third_party/blink/renderer/core/core_initializer.h"
 
+#include "base/feature_list.h"
+#include "third_party/blink/public/common/features.h"
 #include "third_party/blink/public/platform/platform.h"
 #include "third_party/blink/public/web/blink.h"
 #include "third_party/blink/renderer/bindings/core/v8/binding_security.h"
@@ -63,6 +65,7 @@
 #include "third_party/blink/renderer/platform/weborigin/security_policy.h"
 #include "third_party/blink/renderer/platform/wtf/allocator/partitions.h"
 #include "third_party/blink/renderer/platform/wtf/text/atomic_string_table.h"
+#include "third_party/blink/renderer/platform/wtf/text/shared_atomic_string_table.h"
 
 namespace blink {
 
@@ -144,6 +147,8 @@ void CoreInitializer::Initialize() {
 
   RegisterEventFactory();
 
+  if (base::FeatureList::IsEnabled(features::kSharedAtomicStringTable))
+    SharedAtomicStringTable::Enable();
   StringImpl::FreezeStaticStrings();
 
   V8ThrowDOMException::Init();
@@ -40,8 +40,8 @@ namespace blink {
 
 static unsigned ComputeMatchedPropertiesHash(const MatchResult& result) {
   const MatchedPropertiesVector& vector = result.GetMatchedProperties();
-  return StringHasher::HashMemory(vector.data(),
-                                  sizeof(MatchedProperties) * vector.size());
+  return StringHasher::HashMemoryWide(
+      vector.data(), sizeof(MatchedProperties) * vector.size());
 }
 
 void CachedMatchedProperties::Set(
@@ -37,17 +37,17 @@ Node* ChildNodeList::VirtualOwnerNode() const {
 ChildNodeList::~ChildNodeList() = default;
 
 Node* ChildNodeList::item(unsigned index) const {
-  return collection_index_cache_.NodeAt(*this, index);
+  return collection_items_cache_.NodeAt(*this, index);
 }
 
 void ChildNodeList::ChildrenChanged(
     const ContainerNode::ChildrenChange& change) {
   if (change.IsChildInsertion()) {
-    collection_index_cache_.NodeInserted();
+    collection_items_cache_.NodeInserted();
   } else if (change.IsChildRemoval()) {
-    collection_index_cache_.NodeRemoved();
+    collection_items_cache_.NodeRemoved();
   } else {
-    collection_index_cache_.Invalidate();
+    collection_items_cache_.Invalidate();
   }
 }
 
@@ -81,7 +81,7 @@ Node* ChildNodeList::TraverseBackwardToOffset(unsigned offset,
 
 void ChildNodeList::Trace(Visitor* visitor) {
   visitor->Trace(parent_);
-  visitor->Trace(collection_index_cache_);
+  visitor->Trace(collection_items_cache_);
   NodeList::Trace(visitor);
 }
 
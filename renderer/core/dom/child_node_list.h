@@ -25,9 +25,9 @@
 #ifndef THIRD_PARTY_BLINK_RENDERER_CORE_DOM_CHILD_NODE_LIST_H_
 #define THIRD_PARTY_BLINK_RENDERER_CORE_DOM_CHILD_NODE_LIST_H_
 
-#include "third_party/blink/renderer/core/dom/collection_index_cache.h"
 #include "third_party/blink/renderer/core/dom/container_node.h"
 #include "third_party/blink/renderer/core/dom/node_list.h"
+#include "third_party/blink/renderer/core/html/collection_items_cache.h"
 
 namespace blink {
 
@@ -38,13 +38,13 @@ class ChildNodeList final : public NodeList {
 
   // DOM API.
   unsigned length() const override {
-    return collection_index_cache_.NodeCount(*this);
+    return collection_items_cache_.NodeCount(*this);
   }
   Node* item(unsigned index) const override;
 
   // Non-DOM API.
   void ChildrenChanged(const ContainerNode::ChildrenChange&);
-  void InvalidateCache() { collection_index_cache_.Invalidate(); }
+  void InvalidateCache() { collection_items_cache_.Invalidate(); }
   ContainerNode& OwnerNode() const { return *parent_; }
 
   ContainerNode& RootNode() const { return OwnerNode(); }
@@ -67,7 +67,7 @@ class ChildNodeList final : public NodeList {
   Node* VirtualOwnerNode() const override;
 
   Member<ContainerNode> parent_;
-  mutable CollectionIndexCache<ChildNodeList, Node> collection_index_cache_;
+  mutable CollectionItemsCache<ChildNodeList, Node> collection_items_cache_;
 };
 
 template <>
@@ -31,8 +31,8 @@
 namespace blink {
 
 inline unsigned AttributeHash(const Vector<Attribute>& attributes) {
-  return StringHasher::HashMemory(attributes.data(),
-                                  attributes.size() * sizeof(Attribute));
+  return StringHasher::HashMemoryWide(attributes.data(),
+                                      attributes.size() * sizeof(Attribute));
 }
 
 inline bool HasSameAttributes(const Vector<Attribute>& attributes,
@@ -86,7 +86,7 @@ static unsigned ComputePresentationAttributeCacheHash(
     const PresentationAttributeCacheKey& key) {
   DCHECK(key.tag_name);
   DCHECK(key.attributes_and_values.size());
-  unsigned attribute_hash = StringHasher::HashMemory(
+  unsigned attribute_hash = StringHasher::HashMemoryWide(
       key.attributes_and_values.data(),
       key.attributes_and_values.size() * sizeof(key.attributes_and_values[0]));
   return WTF::HashInts(key.tag_name->ExistingHash(), attribute_hash);
@@ -1050,6 +1050,8 @@ static String CreatePlainText(const EphemeralRangeTemplate<Strategy>& range,
   static const unsigned kInitialCapacity = 1 << 15;
 
   StringBuilder builder;
+  // Text nodes that are emitted whole are referenced instead of copied.
+  builder.ShareLargeStrings();
   builder.ReserveCapacity(kInitialCapacity);
 
   for (; !it.AtEnd(); it.Advance())
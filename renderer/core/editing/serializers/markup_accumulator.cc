@@ -143,7 +143,11 @@ MarkupAccumulator::MarkupAccumulator(AbsoluteURLs resolve_urls_method,
                                      SerializationType serialization_type,
                                      IncludeShadowRoots include_shadow_roots)
     : formatter_(resolve_urls_method, serialization_type),
-      include_shadow_roots_(include_shadow_roots) {}
+      include_shadow_roots_(include_shadow_roots) {
+  // Serializations reference the contents of large text nodes instead of
+  // copying them.
+  markup_.ShareLargeStrings();
+}
 
 MarkupAccumulator::~MarkupAccumulator() = default;
 
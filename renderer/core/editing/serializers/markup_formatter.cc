@@ -53,8 +53,10 @@ struct EntityDescription {
   EntityMask mask;
 };
 
+// Appends |text| up to its last entity, with entities replaced, and returns
+// the position after that entity.
 template <typename CharType>
-static inline void AppendCharactersReplacingEntitiesInternal(
+static inline unsigned AppendCharactersReplacingEntitiesInternal(
     StringBuilder& result,
     CharType* text,
     unsigned length,
@@ -76,8 +78,7 @@ static inline void AppendCharactersReplacingEntitiesInternal(
       }
     }
   }
-  result.Append(text + position_after_last_entity,
-                length - position_after_last_entity);
+  return position_after_last_entity;
 }
 
 void MarkupFormatter::AppendCharactersReplacingEntities(
@@ -110,15 +111,25 @@ void MarkupFormatter::AppendCharactersReplacingEntities(
     return;
 
   DCHECK_LE(offset + length, source.length());
+  unsigned position_after_last_entity;
   if (source.Is8Bit()) {
-    AppendCharactersReplacingEntitiesInternal(
+    position_after_last_entity = AppendCharactersReplacingEntitiesInternal(
         result, source.Characters8() + offset, length, kEntityMaps,
         base::size(kEntityMaps), entity_mask);
   } else {
-    AppendCharactersReplacingEntitiesInternal(
+    position_after_last_entity = AppendCharactersReplacingEntitiesInternal(
         result, source.Characters16() + offset, length, kEntityMaps,
         base::size(kEntityMaps), entity_mask);
   }
+
+  // Append text without entities as a whole string, so that builders that
+  // share large strings reference it instead of copying it.
+  if (!position_after_last_entity && !offset && length == source.length()) {
+    result.Append(source);
+    return;
+  }
+  result.Append(StringView(source, offset + position_after_last_entity,
+                           length - position_after_last_entity));
 }
 
 MarkupFormatter::MarkupFormatter(AbsoluteURLs resolve_urls_method,
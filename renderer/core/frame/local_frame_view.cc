@@ -34,6 +34,7 @@
 #include "base/memory/ptr_util.h"
 #include "base/metrics/field_trial_params.h"
 #include "base/numerics/safe_conversions.h"
+#include "base/optional.h"
 #include "cc/input/main_thread_scrolling_reason.h"
 #include "cc/layers/picture_layer.h"
 #include "cc/tiles/frame_viewer_instrumentation.h"
@@ -154,6 +155,7 @@
 #include "third_party/blink/renderer/platform/runtime_enabled_features.h"
 #include "third_party/blink/renderer/platform/scheduler/public/frame_scheduler.h"
 #include "third_party/blink/renderer/platform/web_test_support.h"
+#include "third_party/blink/renderer/platform/wtf/allocator/lifecycle_arena.h"
 #include "third_party/blink/renderer/platform/wtf/std_lib_extras.h"
 #include "third_party/skia/include/core/SkBitmap.h"
 #include "ui/base/cursor/cursor.h"
@@ -729,6 +731,10 @@ void LocalFrameView::PerformLayout(bool in_subtree_layout) {
       PERFORM_LAYOUT_TRACE_CATEGORIES, "LocalFrameView::performLayout",
       "contentsHeightBeforeLayout", contents_height_before_layout);
   PrepareLayoutAnalyzer();
+  // Backings allocated from the arena replace PartitionAlloc allocations,
+  // while its chunks add some.
+  const LifecycleArena::Stats arena_stats_before_layout =
+      LifecycleArena::Current().GetStats();
 
   ScriptForbiddenScope forbid_script;
 
@@ -782,6 +788,19 @@ void LocalFrameView::PerformLayout(bool in_subtree_layout) {
 
   Lifecycle().AdvanceTo(DocumentLifecycle::kAfterPerformLayout);
 
+  if (analyzer_) {
+    const LifecycleArena::Stats& arena_stats =
+        LifecycleArena::Current().GetStats();
+    analyzer_->Increment(
+        LayoutAnalyzer::kLifecycleArenaAllocations,
+        static_cast<unsigned>(arena_stats.arena_allocations -
+                              arena_stats_before_layout.arena_allocations));
+    analyzer_->Increment(
+        LayoutAnalyzer::kLifecycleArenaChunkAllocations,
+        static_cast<unsigned>(arena_stats.chunk_allocations -
+                              arena_stats_before_layout.chunk_allocations));
+  }
+
   TRACE_EVENT_END1(PERFORM_LAYOUT_TRACE_CATEGORIES,
                    "LocalFrameView::performLayout", "counters",
                    AnalyzerCounters());
@@ -833,6 +852,9 @@ void LocalFrameView::UpdateLayout() {
 
   FontCachePurgePreventer font_cache_purge_preventer;
   StyleRetainScope style_retain_scope;
+  base::Optional<LifecycleArena::Scope> lifecycle_arena_scope;
+  if (base::FeatureList::IsEnabled(blink::features::kLifecycleArena))
+    lifecycle_arena_scope.emplace();
   bool in_subtree_layout = false;
   {
     base::AutoReset<bool> change_scheduling_enabled(&layout_scheduling_enabled_,
@@ -37,6 +37,12 @@
 
 namespace blink {
 
+// CollectionItemsCache extends CollectionIndexCache with a list of all the
+// items of the collection, so that any item can be returned in constant time.
+// The list is built when the length of the collection is computed, or once
+// the collection is accessed out of order a few times, e.g. when it is
+// iterated backward or randomly, and is dropped with the rest of the cache
+// when the collection is invalidated.
 template <typename Collection, typename NodeType>
 class CollectionItemsCache : public CollectionIndexCache<Collection, NodeType> {
   DISALLOW_NEW();
@@ -56,33 +62,61 @@ class CollectionItemsCache : public CollectionIndexCache<Collection, NodeType> {
   NodeType* NodeAt(const Collection&, unsigned index);
   void Invalidate();
 
+  void NodeInserted();
+  void NodeRemoved();
+
  private:
+  // The number of accesses that don't follow the previously accessed item
+  // after which the list of items is built.
+  static constexpr unsigned kOutOfOrderAccessesBeforeBuildingList = 2;
+
+  void BuildList(const Collection&);
+  void ClearList();
+
   bool list_valid_;
+  unsigned out_of_order_accesses_;
   HeapVector<Member<NodeType>> cached_list_;
 };
 
 template <typename Collection, typename NodeType>
 CollectionItemsCache<Collection, NodeType>::CollectionItemsCache()
-    : list_valid_(false) {}
+    : list_valid_(false), out_of_order_accesses_(0) {}
 
 template <typename Collection, typename NodeType>
 CollectionItemsCache<Collection, NodeType>::~CollectionItemsCache() = default;
 
 template <typename Collection, typename NodeType>
-void CollectionItemsCache<Collection, NodeType>::Invalidate() {
-  Base::Invalidate();
+void CollectionItemsCache<Collection, NodeType>::ClearList() {
+  out_of_order_accesses_ = 0;
   if (list_valid_) {
     cached_list_.Shrink(0);
     list_valid_ = false;
   }
 }
 
-template <class Collection, class NodeType>
-unsigned CollectionItemsCache<Collection, NodeType>::NodeCount(
-    const Collection& collection) {
-  if (this->IsCachedNodeCountValid())
-    return this->CachedNodeCount();
+template <typename Collection, typename NodeType>
+void CollectionItemsCache<Collection, NodeType>::Invalidate() {
+  Base::Invalidate();
+  ClearList();
+}
+
+template <typename Collection, typename NodeType>
+void CollectionItemsCache<Collection, NodeType>::NodeInserted() {
+  Base::NodeInserted();
+  ClearList();
+}
+
+template <typename Collection, typename NodeType>
+void CollectionItemsCache<Collection, NodeType>::NodeRemoved() {
+  Base::NodeRemoved();
+  ClearList();
+}
 
+template <typename Collection, typename NodeType>
+void CollectionItemsCache<Collection, NodeType>::BuildList(
+    const Collection& collection) {
+  DCHECK(!list_valid_);
+  DCHECK(cached_list_.IsEmpty());
   NodeType* current_node = collection.TraverseToFirst();
   unsigned current_index = 0;
   while (current_node) {
@@ -91,8 +125,19 @@ unsigned CollectionItemsCache<Collection, NodeType>::NodeCount(
         current_index + 1, *current_node, current_index);
   }
 
+  if (this->IsCachedNodeCountValid())
+    DCHECK_EQ(cached_list_.size(), this->CachedNodeCount());
   this->SetCachedNodeCount(cached_list_.size());
   list_valid_ = true;
+}
+
+template <class Collection, class NodeType>
+unsigned CollectionItemsCache<Collection, NodeType>::NodeCount(
+    const Collection& collection) {
+  if (this->IsCachedNodeCountValid())
+    return this->CachedNodeCount();
+
+  BuildList(collection);
   return this->CachedNodeCount();
 }
 
@@ -100,8 +145,19 @@ template <typename Collection, typename NodeType>
 inline NodeType* CollectionItemsCache<Collection, NodeType>::NodeAt(
     const Collection& collection,
     unsigned index) {
-  if (list_valid_) {
-    DCHECK(this->IsCachedNodeCountValid());
+  if (this->IsCachedNodeCountValid() && index >= this->CachedNodeCount())
+    return nullptr;
+  if (list_valid_)
+    return cached_list_[index];
+
+  // Items next to the cached node are found without traversing the
+  // collection, but any other item may take up to a traversal of the whole
+  // collection.
+  if (this->CachedNode() &&
+      (index + 1 < this->CachedNodeIndex() ||
+       index > this->CachedNodeIndex() + 1) &&
+      ++out_of_order_accesses_ >= kOutOfOrderAccessesBeforeBuildingList) {
+    BuildList(collection);
     return index < this->CachedNodeCount() ? cached_list_[index] : nullptr;
   }
   return Base::NodeAt(collection, index);
@@ -0,0 +1,89 @@
+// Copyright 2020 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/core/html/collection_items_cache.h"
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/renderer/core/dom/child_node_list.h"
+#include "third_party/blink/renderer/core/dom/element.h"
+#include "third_party/blink/renderer/core/html/html_collection.h"
+#include "third_party/blink/renderer/core/html/html_element.h"
+#include "third_party/blink/renderer/core/html_names.h"
+#include "third_party/blink/renderer/core/testing/page_test_base.h"
+#include "third_party/blink/renderer/platform/wtf/text/string_builder.h"
+
+namespace blink {
+
+namespace {
+
+constexpr unsigned kItemCount = 10;
+
+// The items are accessed out of order, so the items cache builds its list.
+const unsigned kRandomOrder[] = {7, 2, 9, 0, 5, 4, 8, 1, 3, 6};
+
+String ItemId(Node* node) {
+  auto* element = DynamicTo<Element>(node);
+  return element ? element->GetIdAttribute() : String();
+}
+
+}  // namespace
+
+class CollectionItemsCacheTest : public PageTestBase {
+ protected:
+  void SetUp() override {
+    PageTestBase::SetUp();
+    StringBuilder html;
+    for (unsigned i = 0; i < kItemCount; ++i) {
+      html.Append("<div class=item id=");
+      html.AppendNumber(i);
+      html.Append("></div>");
+    }
+    SetBodyInnerHTML(html.ToString());
+  }
+};
+
+TEST_F(CollectionItemsCacheTest, ChildNodeListRandomAccess) {
+  NodeList* child_nodes = GetDocument().body()->childNodes();
+  for (unsigned index : kRandomOrder)
+    EXPECT_EQ(String::Number(index), ItemId(child_nodes->item(index)));
+  EXPECT_FALSE(child_nodes->item(kItemCount));
+  EXPECT_EQ(kItemCount, child_nodes->length());
+
+  // Backward iteration.
+  for (unsigned index = kItemCount; index--;)
+    EXPECT_EQ(String::Number(index), ItemId(child_nodes->item(index)));
+}
+
+TEST_F(CollectionItemsCacheTest, ChildNodeListRandomAccessAfterMutation) {
+  NodeList* child_nodes = GetDocument().body()->childNodes();
+  for (unsigned index : kRandomOrder)
+    child_nodes->item(index);
+
+  auto* last = GetDocument().CreateRawElement(html_names::kDivTag);
+  last->SetIdAttribute("last");
+  GetDocument().body()->AppendChild(last);
+  EXPECT_EQ(kItemCount + 1, child_nodes->length());
+  EXPECT_EQ(last, child_nodes->item(kItemCount));
+
+  GetDocument().body()->RemoveChild(GetDocument().body()->firstChild());
+  EXPECT_EQ(kItemCount, child_nodes->length());
+  for (unsigned index : kRandomOrder)
+    EXPECT_EQ(String::Number(index + 1), ItemId(child_nodes->item(index)));
+  EXPECT_EQ(last, child_nodes->item(kItemCount - 1));
+  EXPECT_FALSE(child_nodes->item(kItemCount));
+}
+
+TEST_F(CollectionItemsCacheTest, HTMLCollectionRandomAccessAfterInvalidation) {
+  HTMLCollection* items =
+      GetDocument().getElementsByClassName(AtomicString("item"));
+  for (unsigned index : kRandomOrder)
+    EXPECT_EQ(String::Number(index), ItemId(items->item(index)));
+
+  GetDocument().getElementById("0")->removeAttribute(html_names::kClassAttr);
+  EXPECT_EQ(kItemCount - 1, items->length());
+  for (unsigned index = kItemCount - 1; index--;)
+    EXPECT_EQ(String::Number(index + 1), ItemId(items->item(index)));
+}
+
+}  // namespace blink
@@ -426,6 +426,8 @@ const char* NotStreamedReasonString(ScriptStreamer::NotStreamingReason reason) {
       return "worker top-level scripts are not streamable";
     case ScriptStreamer::kModuleScript:
       return "module script";
+    case ScriptStreamer::kScriptTypeMismatch:
+      return "script streamed as another script type";
     case ScriptStreamer::kAlreadyLoaded:
     case ScriptStreamer::kCount:
     case ScriptStreamer::kInvalid:
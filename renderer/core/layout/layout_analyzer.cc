@@ -151,6 +151,10 @@ const char* LayoutAnalyzer::NameForCounter(Counter counter) const {
              "h";
     case kTotalLayoutObjectsThatWereLaidOut:
       return "TotalLayoutObjectsThatWereLaidOut";
+    case kLifecycleArenaAllocations:
+      return "LifecycleArenaAllocations";
+    case kLifecycleArenaChunkAllocations:
+      return "LifecycleArenaChunkAllocations";
   }
   NOTREACHED();
   return "";
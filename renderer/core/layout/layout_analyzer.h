@@ -45,8 +45,10 @@ class LayoutAnalyzer {
     kLayoutObjectsThatAreTextAndCanUseTheSimpleFontCodePath,
     kCharactersInLayoutObjectsThatAreTextAndCanUseTheSimpleFontCodePath,
     kTotalLayoutObjectsThatWereLaidOut,
+    kLifecycleArenaAllocations,
+    kLifecycleArenaChunkAllocations,
   };
-  static const size_t kNumCounters = 21;
+  static const size_t kNumCounters = 23;
 
   class Scope {
     STACK_ALLOCATED();
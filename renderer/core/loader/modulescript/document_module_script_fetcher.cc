@@ -4,9 +4,13 @@
 
 #include "third_party/blink/renderer/core/loader/modulescript/document_module_script_fetcher.h"
 
+#include "base/feature_list.h"
+#include "third_party/blink/public/common/features.h"
+#include "third_party/blink/public/mojom/script/script_type.mojom-blink.h"
 #include "third_party/blink/renderer/core/inspector/console_message.h"
 #include "third_party/blink/renderer/platform/bindings/parkable_string.h"
 #include "third_party/blink/renderer/platform/heap/heap.h"
+#include "third_party/blink/renderer/platform/wtf/functional.h"
 #include "third_party/blink/renderer/platform/wtf/vector.h"
 
 namespace blink {
@@ -24,8 +28,23 @@ void DocumentModuleScriptFetcher::Fetch(
   DCHECK(!client_);
   client_ = client;
 
-  ScriptResource::Fetch(fetch_params, fetch_client_settings_object_fetcher,
-                        this, ScriptResource::kNoStreaming);
+  if (!base::FeatureList::IsEnabled(features::kModuleScriptStreaming)) {
+    ScriptResource::Fetch(fetch_params, fetch_client_settings_object_fetcher,
+                          this, ScriptResource::kNoStreaming);
+    return;
+  }
+
+  // Stream the module script to V8 as soon as its data arrives, so that it is
+  // parsed while the rest of the module graph is fetched.
+  ScriptResource* resource = ScriptResource::Fetch(
+      fetch_params, fetch_client_settings_object_fetcher, this,
+      ScriptResource::kAllowStreaming, mojom::ScriptType::kModule);
+  // Unlike classic scripts, module scripts are needed as soon as they are
+  // loaded, to fetch their descendants. This is a no-op if streaming started.
+  // Do this in a task, as it can notify the other clients of the resource.
+  fetch_client_settings_object_fetcher->GetTaskRunner()->PostTask(
+      FROM_HERE, WTF::Bind(&ScriptResource::SetClientIsWaitingForFinished,
+                           WrapWeakPersistent(resource)));
 }
 
 void DocumentModuleScriptFetcher::NotifyFinished(Resource* resource) {
@@ -41,10 +60,31 @@ void DocumentModuleScriptFetcher::NotifyFinished(Resource* resource) {
     return;
   }
 
+  // Check if the module script was streamed to V8 and can be compiled from
+  // the streamed data.
+  ScriptStreamer::NotStreamingReason not_streaming_reason =
+      script_resource->NoStreamerReason();
+  ScriptStreamer* streamer = script_resource->TakeStreamer();
+  if (streamer) {
+    DCHECK_EQ(not_streaming_reason, ScriptStreamer::kInvalid);
+    if (streamer->StreamingSuppressed()) {
+      not_streaming_reason = streamer->StreamingSuppressedReason();
+      streamer = nullptr;
+    } else if (streamer->GetScriptType() != mojom::ScriptType::kModule ||
+               module_type !=
+                   ModuleScriptCreationParams::ModuleType::kJavaScriptModule) {
+      // The resource was streamed for a classic script, or as JavaScript for
+      // a JSON or CSS module script.
+      not_streaming_reason = ScriptStreamer::kScriptTypeMismatch;
+      streamer = nullptr;
+    }
+  }
+
   ModuleScriptCreationParams params(
       script_resource->GetResponse().CurrentRequestUrl(), module_type,
       script_resource->SourceText(), script_resource->CacheHandler(),
-      script_resource->GetResourceRequest().GetCredentialsMode());
+      script_resource->GetResourceRequest().GetCredentialsMode(), streamer,
+      not_streaming_reason);
   client_->NotifyFetchFinished(params, error_messages);
 }
 
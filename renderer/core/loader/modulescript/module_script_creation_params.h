@@ -7,6 +7,7 @@
 
 #include "base/optional.h"
 #include "third_party/blink/public/platform/web_url_request.h"
+#include "third_party/blink/renderer/bindings/core/v8/script_streamer.h"
 #include "third_party/blink/renderer/platform/bindings/parkable_string.h"
 #include "third_party/blink/renderer/platform/heap/persistent.h"
 #include "third_party/blink/renderer/platform/loader/fetch/cached_metadata_handler.h"
@@ -28,14 +29,21 @@ class ModuleScriptCreationParams {
       const ModuleScriptCreationParams::ModuleType module_type,
       const ParkableString& source_text,
       SingleCachedMetadataHandler* cache_handler,
-      network::mojom::CredentialsMode credentials_mode)
+      network::mojom::CredentialsMode credentials_mode,
+      ScriptStreamer* streamer = nullptr,
+      ScriptStreamer::NotStreamingReason not_streaming_reason =
+          ScriptStreamer::kModuleScript)
       : response_url_(response_url),
         module_type_(module_type),
         is_isolated_(false),
         source_text_(source_text),
         isolated_source_text_(),
         cache_handler_(cache_handler),
-        credentials_mode_(credentials_mode) {}
+        credentials_mode_(credentials_mode),
+        streamer_(streamer),
+        not_streaming_reason_(not_streaming_reason) {
+    DCHECK_EQ(!streamer, not_streaming_reason != ScriptStreamer::kInvalid);
+  }
 
   ~ModuleScriptCreationParams() = default;
 
@@ -66,6 +74,10 @@ class ModuleScriptCreationParams {
   network::mojom::CredentialsMode GetFetchCredentialsMode() const {
     return credentials_mode_;
   }
+  ScriptStreamer* Streamer() const { return streamer_; }
+  ScriptStreamer::NotStreamingReason NotStreamingReason() const {
+    return not_streaming_reason_;
+  }
 
   bool IsSafeToSendToAnotherThread() const {
     return response_url_.IsSafeToSendToAnotherThread() && is_isolated_;
@@ -83,7 +95,8 @@ class ModuleScriptCreationParams {
         is_isolated_(true),
         source_text_(),
         isolated_source_text_(isolated_source_text),
-        credentials_mode_(credentials_mode) {}
+        credentials_mode_(credentials_mode),
+        not_streaming_reason_(ScriptStreamer::kModuleScript) {}
 
   const KURL response_url_;
   const ModuleType module_type_;
@@ -98,6 +111,10 @@ class ModuleScriptCreationParams {
   Persistent<SingleCachedMetadataHandler> cache_handler_;
 
   const network::mojom::CredentialsMode credentials_mode_;
+
+  // |streamer_| is cleared when crossing thread boundaries.
+  Persistent<ScriptStreamer> streamer_;
+  const ScriptStreamer::NotStreamingReason not_streaming_reason_;
 };
 
 }  // namespace blink
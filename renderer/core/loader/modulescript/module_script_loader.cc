@@ -272,7 +272,9 @@ void ModuleScriptLoader::NotifyFetchFinished(
       module_script_ = JSModuleScript::Create(
           params->GetSourceText(), params->CacheHandler(),
           ScriptSourceLocationType::kExternalFile, modulator_,
-          params->GetResponseUrl(), params->GetResponseUrl(), options_);
+          params->GetResponseUrl(), params->GetResponseUrl(), options_,
+          TextPosition::MinimumPosition(), params->Streamer(),
+          params->NotStreamingReason());
       break;
   }
 
@@ -30,6 +30,7 @@
 
 #include "third_party/blink/public/common/features.h"
 #include "third_party/blink/public/mojom/loader/request_context_frame_type.mojom-blink.h"
+#include "third_party/blink/public/mojom/script/script_type.mojom-blink.h"
 #include "third_party/blink/renderer/core/dom/document.h"
 #include "third_party/blink/renderer/core/loader/subresource_integrity_helper.h"
 #include "third_party/blink/renderer/platform/instrumentation/tracing/web_memory_allocator_dump.h"
@@ -77,7 +78,8 @@ bool IsRequestContextSupported(mojom::RequestContextType request_context) {
 ScriptResource* ScriptResource::Fetch(FetchParameters& params,
                                       ResourceFetcher* fetcher,
                                       ResourceClient* client,
-                                      StreamingAllowed streaming_allowed) {
+                                      StreamingAllowed streaming_allowed,
+                                      mojom::ScriptType script_type) {
   DCHECK(IsRequestContextSupported(
       params.GetResourceRequest().GetRequestContext()));
   ScriptResource* resource = ToScriptResource(
@@ -85,7 +87,7 @@ ScriptResource* ScriptResource::Fetch(FetchParameters& params,
 
   if (streaming_allowed == kAllowStreaming) {
     // Start streaming the script as soon as we get it.
-    resource->StartStreaming(fetcher->GetTaskRunner());
+    resource->StartStreaming(fetcher->GetTaskRunner(), script_type);
   } else {
     // Advance the |streaming_state_| to kStreamingNotAllowed by calling
     // SetClientIsWaitingForFinished unless it is explicitly allowed.'
@@ -409,7 +411,8 @@ void ScriptResource::StreamingFinished() {
 }
 
 void ScriptResource::StartStreaming(
-    scoped_refptr<base::SingleThreadTaskRunner> loading_task_runner) {
+    scoped_refptr<base::SingleThreadTaskRunner> loading_task_runner,
+    mojom::ScriptType script_type) {
   CheckStreamingState();
 
   if (streamer_) {
@@ -433,8 +436,8 @@ void ScriptResource::StartStreaming(
 
   CHECK(!IsCacheValidator());
 
-  streamer_ =
-      ScriptStreamer::Create(this, loading_task_runner, &not_streaming_reason_);
+  streamer_ = ScriptStreamer::Create(this, script_type, loading_task_runner,
+                                     &not_streaming_reason_);
   if (streamer_) {
     AdvanceStreamingState(StreamingState::kStreaming);
 
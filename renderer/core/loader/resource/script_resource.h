@@ -28,6 +28,7 @@
 
 #include <memory>
 
+#include "third_party/blink/public/mojom/script/script_type.mojom-blink-forward.h"
 #include "third_party/blink/renderer/bindings/core/v8/script_streamer.h"
 #include "third_party/blink/renderer/core/core_export.h"
 #include "third_party/blink/renderer/core/loader/resource/text_resource.h"
@@ -73,12 +74,16 @@ class CORE_EXPORT ScriptResource final : public TextResource {
   // Scripts fetched with kNoStreaming will (asynchronously) call
   // SetClientIsWaitingForFinished on the resource, so the user does not have to
   // call it again. This is effectively the "legacy" behaviour.
+  //
+  // |script_type| is the type of script that the streamed data is parsed as.
   enum StreamingAllowed { kNoStreaming, kAllowStreaming };
 
-  static ScriptResource* Fetch(FetchParameters&,
-                               ResourceFetcher*,
-                               ResourceClient*,
-                               StreamingAllowed);
+  static ScriptResource* Fetch(
+      FetchParameters&,
+      ResourceFetcher*,
+      ResourceClient*,
+      StreamingAllowed,
+      mojom::ScriptType script_type = mojom::ScriptType::kClassic);
 
   // Public for testing
   static ScriptResource* CreateForTest(const KURL& url,
@@ -100,8 +105,12 @@ class CORE_EXPORT ScriptResource final : public TextResource {
 
   void SetSerializedCachedMetadata(mojo_base::BigBuffer data) override;
 
+  // Streaming parses the script as a |script_type| script. Clients must check
+  // the ScriptStreamer::GetScriptType() of TakeStreamer(), as the resource
+  // may be shared with a client of another script type.
   void StartStreaming(
-      scoped_refptr<base::SingleThreadTaskRunner> loading_task_runner);
+      scoped_refptr<base::SingleThreadTaskRunner> loading_task_runner,
+      mojom::ScriptType script_type = mojom::ScriptType::kClassic);
 
   // State that a client of the script resource will no longer try to start
   // streaming, and is now waiting for the resource to call the client's finish
@@ -4,6 +4,7 @@
 
 #include "third_party/blink/renderer/core/script/classic_pending_script.h"
 
+#include "third_party/blink/public/mojom/script/script_type.mojom-blink.h"
 #include "third_party/blink/public/platform/task_type.h"
 #include "third_party/blink/renderer/bindings/core/v8/script_source_code.h"
 #include "third_party/blink/renderer/bindings/core/v8/script_streamer.h"
@@ -374,6 +375,9 @@ ClassicScript* ClassicPendingScript::GetSource(const KURL& document_url) const {
     DCHECK_EQ(not_streamed_reason, ScriptStreamer::kInvalid);
     if (streamer->StreamingSuppressed()) {
       not_streamed_reason = streamer->StreamingSuppressedReason();
+    } else if (streamer->GetScriptType() != mojom::ScriptType::kClassic) {
+      // The resource was streamed for a module script.
+      not_streamed_reason = ScriptStreamer::kScriptTypeMismatch;
     } else if (ready_state_ == kErrorOccurred) {
       not_streamed_reason = ScriptStreamer::kErrorOccurred;
     } else {
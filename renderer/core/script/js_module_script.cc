@@ -5,6 +5,7 @@
 #include "third_party/blink/renderer/core/script/js_module_script.h"
 
 #include "third_party/blink/renderer/bindings/core/v8/script_value.h"
+#include "third_party/blink/renderer/core/script/module_graph_code_cache.h"
 #include "third_party/blink/renderer/core/script/module_record_resolver.h"
 #include "third_party/blink/renderer/platform/bindings/script_state.h"
 #include "v8/include/v8.h"
@@ -21,12 +22,19 @@ JSModuleScript* JSModuleScript::Create(
     const KURL& source_url,
     const KURL& base_url,
     const ScriptFetchOptions& options,
-    const TextPosition& start_position) {
+    const TextPosition& start_position,
+    ScriptStreamer* streamer,
+    ScriptStreamer::NotStreamingReason not_streaming_reason) {
   // <spec step="1">If scripting is disabled for settings's responsible browsing
   // context, then set source to the empty string.</spec>
   ParkableString source_text;
-  if (!modulator->IsScriptingDisabled())
+  if (!modulator->IsScriptingDisabled()) {
     source_text = original_source_text;
+  } else if (streamer) {
+    // [not specced] The streamed source doesn't match the empty string.
+    streamer = nullptr;
+    not_streaming_reason = ScriptStreamer::kStreamingDisabled;
+  }
 
   // <spec step="2">Let script be a new module script that this algorithm will
   // subsequently initialize.</spec>
@@ -45,10 +53,39 @@ JSModuleScript* JSModuleScript::Create(
 
   ModuleRecordProduceCacheData* produce_cache_data = nullptr;
 
+  // [not specced] If the module script is the root of a module graph whose
+  // code caches were stored together, make them available to the whole
+  // graph, then look up the code cache of this module script. If there is
+  // one, compile with it even if the module script was streamed. Otherwise
+  // the module script would lose its entry when the code caches of the graph
+  // are stored again.
+  ModuleGraphCodeCache* module_graph_code_cache =
+      modulator->GetModuleGraphCodeCache();
+  uint32_t source_hash = 0;
+  std::unique_ptr<v8::ScriptCompiler::CachedData> graph_cached_data;
+  if (module_graph_code_cache &&
+      modulator->GetV8CacheOptions() != kV8CacheOptionsNone) {
+    if (cache_handler)
+      module_graph_code_cache->AddModuleGraphFrom(source_url, cache_handler);
+    source_hash = ModuleGraphCodeCache::SourceHash(source_text.ToString());
+    graph_cached_data =
+        module_graph_code_cache->FindCodeCache(source_url, source_hash);
+    if (graph_cached_data && streamer) {
+      streamer = nullptr;
+      not_streaming_reason = ScriptStreamer::kHasCodeCache;
+    }
+  }
+
   v8::Local<v8::Module> result = ModuleRecord::Compile(
       isolate, source_text.ToString(), source_url, base_url, options,
       start_position, exception_state, modulator->GetV8CacheOptions(),
-      cache_handler, source_location_type, &produce_cache_data);
+      cache_handler, source_location_type, &produce_cache_data,
+      graph_cached_data.get(), streamer, not_streaming_reason);
+
+  if (module_graph_code_cache && produce_cache_data) {
+    produce_cache_data->SetModuleGraphCodeCacheState(
+        source_hash, graph_cached_data && !graph_cached_data->rejected);
+  }
 
   // CreateInternal processes Steps 4 and 8-10.
   //
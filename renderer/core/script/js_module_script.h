@@ -5,6 +5,7 @@
 #ifndef THIRD_PARTY_BLINK_RENDERER_CORE_SCRIPT_JS_MODULE_SCRIPT_H_
 #define THIRD_PARTY_BLINK_RENDERER_CORE_SCRIPT_JS_MODULE_SCRIPT_H_
 
+#include "third_party/blink/renderer/bindings/core/v8/script_streamer.h"
 #include "third_party/blink/renderer/bindings/core/v8/script_value.h"
 #include "third_party/blink/renderer/core/core_export.h"
 #include "third_party/blink/renderer/core/script/modulator.h"
@@ -25,6 +26,9 @@ class CORE_EXPORT JSModuleScript final : public ModuleScript,
                                          public NameClient {
  public:
   // https://html.spec.whatwg.org/C/#creating-a-javascript-module-script
+  //
+  // |streamer| is the ScriptStreamer that streamed |source_text| to V8, if
+  // any. Otherwise, |not_streaming_reason| says why it wasn't streamed.
   static JSModuleScript* Create(
       const ParkableString& source_text,
       SingleCachedMetadataHandler*,
@@ -33,7 +37,10 @@ class CORE_EXPORT JSModuleScript final : public ModuleScript,
       const KURL& source_url,
       const KURL& base_url,
       const ScriptFetchOptions&,
-      const TextPosition& start_position = TextPosition::MinimumPosition());
+      const TextPosition& start_position = TextPosition::MinimumPosition(),
+      ScriptStreamer* streamer = nullptr,
+      ScriptStreamer::NotStreamingReason not_streaming_reason =
+          ScriptStreamer::kModuleScript);
 
   // Mostly corresponds to Create() but accepts ModuleRecord as the argument
   // and allows null ModuleRecord.
@@ -56,6 +63,9 @@ class CORE_EXPORT JSModuleScript final : public ModuleScript,
   ~JSModuleScript() override = default;
 
   void ProduceCache() override;
+  const ModuleRecordProduceCacheData* GetProduceCacheData() const override {
+    return produce_cache_data_;
+  }
 
   void Trace(Visitor*) override;
   const char* NameInHeapSnapshot() const override { return "JSModuleScript"; }
@@ -31,6 +31,7 @@ class ModuleScriptLoader;
 class ImportMap;
 class ReferrerScriptInfo;
 class ResourceFetcher;
+class ModuleGraphCodeCache;
 class ModuleRecordResolver;
 class ScriptPromiseResolver;
 class ScriptState;
@@ -116,6 +117,9 @@ class CORE_EXPORT Modulator : public GarbageCollected<Modulator>,
 
   virtual V8CacheOptions GetV8CacheOptions() const = 0;
 
+  // Returns null unless features::kModuleGraphCodeCache is enabled.
+  virtual ModuleGraphCodeCache* GetModuleGraphCodeCache() = 0;
+
   // https://html.spec.whatwg.org/C/#concept-bc-noscript
   // "scripting is disabled for settings's responsible browsing context"
   virtual bool IsScriptingDisabled() const = 0;
@@ -17,6 +17,7 @@
 #include "third_party/blink/renderer/core/script/dynamic_module_resolver.h"
 #include "third_party/blink/renderer/core/script/import_map.h"
 #include "third_party/blink/renderer/core/script/js_module_script.h"
+#include "third_party/blink/renderer/core/script/module_graph_code_cache.h"
 #include "third_party/blink/renderer/core/script/module_map.h"
 #include "third_party/blink/renderer/core/script/module_record_resolver_impl.h"
 #include "third_party/blink/renderer/core/script/parsed_specifier.h"
@@ -43,6 +44,8 @@ ModulatorImplBase::ModulatorImplBase(ScriptState* script_state)
           MakeGarbageCollected<DynamicModuleResolver>(this)) {
   DCHECK(script_state_);
   DCHECK(task_runner_);
+  if (base::FeatureList::IsEnabled(features::kModuleGraphCodeCache))
+    module_graph_code_cache_ = MakeGarbageCollected<ModuleGraphCodeCache>();
 }
 
 ModulatorImplBase::~ModulatorImplBase() {}
@@ -287,12 +290,29 @@ void ModulatorImplBase::ProduceCacheModuleTreeTopLevel(
   if (!script_state_->ContextIsValid())
     return;
   HeapHashSet<Member<const ModuleScript>> discovered_set;
-  ProduceCacheModuleTree(module_script, &discovered_set);
+  if (!module_graph_code_cache_) {
+    ProduceCacheModuleTree(module_script, &discovered_set, nullptr);
+    return;
+  }
+
+  // The root module script may have been the root of another module graph
+  // too, in which case its code caches were already collected.
+  const ModuleRecordProduceCacheData* root_produce_cache_data =
+      module_script->GetProduceCacheData();
+  SingleCachedMetadataHandler* root_cache_handler =
+      root_produce_cache_data ? root_produce_cache_data->CacheHandler()
+                              : nullptr;
+  ModuleGraphCodeCache::Builder builder(*module_graph_code_cache_,
+                                        module_script->SourceURL());
+  ProduceCacheModuleTree(module_script, &discovered_set, &builder);
+  builder.Finish(root_cache_handler);
+  module_graph_code_cache_->RemoveModuleGraph(module_script->SourceURL());
 }
 
 void ModulatorImplBase::ProduceCacheModuleTree(
     ModuleScript* module_script,
-    HeapHashSet<Member<const ModuleScript>>* discovered_set) {
+    HeapHashSet<Member<const ModuleScript>>* discovered_set,
+    ModuleGraphCodeCache::Builder* builder) {
   DCHECK(module_script);
 
   v8::Isolate* isolate = GetScriptState()->GetIsolate();
@@ -303,6 +323,10 @@ void ModulatorImplBase::ProduceCacheModuleTree(
   v8::Local<v8::Module> record = module_script->V8Module();
   DCHECK(!record.IsEmpty());
 
+  if (builder) {
+    builder->AddModule(module_script->SourceURL(),
+                       module_script->GetProduceCacheData());
+  }
   module_script->ProduceCache();
 
   Vector<Modulator::ModuleRequest> child_specifiers =
@@ -322,7 +346,7 @@ void ModulatorImplBase::ProduceCacheModuleTree(
     if (discovered_set->Contains(child_module))
       continue;
 
-    ProduceCacheModuleTree(child_module, discovered_set);
+    ProduceCacheModuleTree(child_module, discovered_set, builder);
   }
 }
 
@@ -409,6 +433,7 @@ void ModulatorImplBase::Trace(Visitor* visitor) {
   visitor->Trace(tree_linker_registry_);
   visitor->Trace(module_record_resolver_);
   visitor->Trace(dynamic_module_resolver_);
+  visitor->Trace(module_graph_code_cache_);
   visitor->Trace(import_map_);
 
   Modulator::Trace(visitor);
@@ -8,6 +8,7 @@
 #include "base/single_thread_task_runner.h"
 #include "third_party/blink/renderer/bindings/core/v8/module_record.h"
 #include "third_party/blink/renderer/core/script/modulator.h"
+#include "third_party/blink/renderer/core/script/module_graph_code_cache.h"
 #include "third_party/blink/renderer/platform/bindings/script_wrappable.h"
 #include "third_party/blink/renderer/platform/bindings/v8_per_isolate_data.h"
 #include "third_party/blink/renderer/platform/heap/handle.h"
@@ -46,6 +47,9 @@ class ModulatorImplBase : public Modulator {
   ModuleRecordResolver* GetModuleRecordResolver() override {
     return module_record_resolver_.Get();
   }
+  ModuleGraphCodeCache* GetModuleGraphCodeCache() override {
+    return module_graph_code_cache_.Get();
+  }
   base::SingleThreadTaskRunner* TaskRunner() override {
     return task_runner_.get();
   }
@@ -100,8 +104,11 @@ class ModulatorImplBase : public Modulator {
   virtual bool IsDynamicImportForbidden(String* reason) = 0;
 
   void ProduceCacheModuleTreeTopLevel(ModuleScript*);
+  // Collects the code caches of the module graph into |builder| if it is not
+  // null.
   void ProduceCacheModuleTree(ModuleScript*,
-                              HeapHashSet<Member<const ModuleScript>>*);
+                              HeapHashSet<Member<const ModuleScript>>*,
+                              ModuleGraphCodeCache::Builder* builder);
 
   Member<ScriptState> script_state_;
   scoped_refptr<base::SingleThreadTaskRunner> task_runner_;
@@ -109,6 +116,7 @@ class ModulatorImplBase : public Modulator {
   Member<ModuleTreeLinkerRegistry> tree_linker_registry_;
   Member<ModuleRecordResolver> module_record_resolver_;
   Member<DynamicModuleResolver> dynamic_module_resolver_;
+  Member<ModuleGraphCodeCache> module_graph_code_cache_;
 
   Member<const ImportMap> import_map_;
 
@@ -0,0 +1,263 @@
+// Copyright 2020 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/core/script/module_graph_code_cache.h"
+
+#include <string.h>
+
+#include "base/hash/hash.h"
+#include "base/numerics/safe_conversions.h"
+#include "third_party/blink/renderer/bindings/core/v8/module_record.h"
+#include "third_party/blink/renderer/bindings/core/v8/v8_code_cache.h"
+#include "third_party/blink/renderer/platform/instrumentation/tracing/trace_event.h"
+#include "third_party/blink/renderer/platform/loader/fetch/cached_metadata_handler.h"
+
+namespace blink {
+
+namespace {
+
+// A module graph code cache is a count of entries followed by the entries.
+// Each entry is an EntryHeader, the UTF-8 URL of its module script and its
+// code cache. Code caches start at offsets that are multiples of kAlignment,
+// like CachedMetadata::Data(), so that V8 doesn't copy them before use.
+struct EntryHeader {
+  uint32_t url_length;
+  uint32_t source_hash;
+  uint32_t code_cache_length;
+};
+
+constexpr size_t kAlignment = 8;
+
+size_t AlignOffset(size_t offset) {
+  return (offset + kAlignment - 1) & ~(kAlignment - 1);
+}
+
+}  // namespace
+
+ModuleGraphCodeCache::Builder::Builder(const ModuleGraphCodeCache& code_cache,
+                                       const KURL& root_url)
+    : code_cache_(code_cache), root_url_(root_url.GetString()) {}
+
+void ModuleGraphCodeCache::Builder::AddModule(
+    const KURL& source_url,
+    const ModuleRecordProduceCacheData* produce_cache_data) {
+  // The code cache of the module script was produced with another module
+  // graph.
+  if (!produce_cache_data || !produce_cache_data->CacheHandler())
+    return;
+  modules_.push_back(Module{source_url.GetString(),
+                            produce_cache_data->CacheHandler(),
+                            produce_cache_data->ConsumedModuleGraphCodeCache(),
+                            produce_cache_data->ModuleGraphSourceHash()});
+}
+
+void ModuleGraphCodeCache::Builder::Finish(
+    SingleCachedMetadataHandler* root_cache_handler) {
+  if (!root_cache_handler)
+    return;
+
+  Vector<Entry> entries;
+  // Keeps the code caches taken from |cache_handler|s alive.
+  Vector<scoped_refptr<CachedMetadata>> code_caches;
+  bool has_new_code_cache = false;
+  for (const Module& module : modules_) {
+    if (module.consumed_module_graph_code_cache) {
+      base::span<const uint8_t> code_cache =
+          code_cache_.FindCodeCacheData(module.url, module.source_hash);
+      if (!code_cache.empty())
+        entries.push_back(Entry{module.url, module.source_hash, code_cache});
+      continue;
+    }
+    // The code cache was just produced for this module script, or the module
+    // script consumed it from its own resource.
+    scoped_refptr<CachedMetadata> code_cache =
+        module.cache_handler->GetCachedMetadata(
+            V8CodeCache::TagForCodeCache(module.cache_handler));
+    if (!code_cache)
+      continue;
+    entries.push_back(Entry{module.url, module.source_hash,
+                            base::make_span(code_cache->Data(),
+                                            code_cache->size())});
+    code_caches.push_back(std::move(code_cache));
+    has_new_code_cache = true;
+  }
+
+  // A module graph code cache with only the code cache of the root module
+  // script is no better than the code cache of the root module script.
+  if (!has_new_code_cache ||
+      (entries.size() == 1 && entries.front().url == root_url_)) {
+    return;
+  }
+
+  TRACE_EVENT1("v8", "ModuleGraphCodeCache::Builder::Finish", "modules",
+               entries.size());
+  Vector<uint8_t> data = Serialize(entries);
+  root_cache_handler->ClearCachedMetadata(CachedMetadataHandler::kClearLocally);
+  root_cache_handler->SetCachedMetadata(
+      V8CodeCache::TagForModuleGraphCodeCache(root_cache_handler), data.data(),
+      data.size());
+}
+
+// static
+uint32_t ModuleGraphCodeCache::SourceHash(const String& source_text) {
+  return base::PersistentHash(source_text.Bytes(),
+                              source_text.CharactersSizeInBytes());
+}
+
+// static
+Vector<uint8_t> ModuleGraphCodeCache::Serialize(const Vector<Entry>& entries) {
+  Vector<std::string> urls;
+  urls.ReserveInitialCapacity(entries.size());
+  size_t size = sizeof(uint32_t);
+  for (const Entry& entry : entries) {
+    urls.push_back(entry.url.Utf8());
+    size = AlignOffset(size + sizeof(EntryHeader) + urls.back().size()) +
+           entry.code_cache.size();
+  }
+
+  Vector<uint8_t> data;
+  data.ReserveInitialCapacity(base::checked_cast<wtf_size_t>(size));
+  auto append = [&data](const void* bytes, size_t length) {
+    data.Append(static_cast<const uint8_t*>(bytes),
+                static_cast<wtf_size_t>(length));
+  };
+  uint32_t count = entries.size();
+  append(&count, sizeof(count));
+  for (wtf_size_t i = 0; i < entries.size(); ++i) {
+    EntryHeader header = {
+        base::checked_cast<uint32_t>(urls[i].size()), entries[i].source_hash,
+        base::checked_cast<uint32_t>(entries[i].code_cache.size())};
+    append(&header, sizeof(header));
+    append(urls[i].data(), urls[i].size());
+    data.Grow(static_cast<wtf_size_t>(AlignOffset(data.size())));
+    append(entries[i].code_cache.data(), entries[i].code_cache.size());
+  }
+  DCHECK_EQ(size, data.size());
+  return data;
+}
+
+// static
+bool ModuleGraphCodeCache::Deserialize(base::span<const uint8_t> data,
+                                       Vector<Entry>* entries) {
+  uint32_t count;
+  if (data.size() < sizeof(count))
+    return false;
+  memcpy(&count, data.data(), sizeof(count));
+  // Each entry takes at least sizeof(EntryHeader) bytes, which bounds |count|
+  // before anything is allocated.
+  if (count > data.size() / sizeof(EntryHeader))
+    return false;
+  entries->ReserveInitialCapacity(count);
+
+  size_t offset = sizeof(count);
+  for (uint32_t i = 0; i < count; ++i) {
+    EntryHeader header;
+    if (data.size() - offset < sizeof(header))
+      return false;
+    memcpy(&header, data.data() + offset, sizeof(header));
+    offset += sizeof(header);
+    if (data.size() - offset < header.url_length)
+      return false;
+    String url = String::FromUTF8(
+        reinterpret_cast<const char*>(data.data() + offset), header.url_length);
+    offset = AlignOffset(offset + header.url_length);
+    if (offset > data.size() ||
+        data.size() - offset < header.code_cache_length) {
+      return false;
+    }
+    entries->push_back(
+        Entry{url, header.source_hash,
+              data.subspan(offset, header.code_cache_length)});
+    offset += header.code_cache_length;
+  }
+  return offset == data.size();
+}
+
+void ModuleGraphCodeCache::AddModuleGraphFrom(
+    const KURL& root_url,
+    const SingleCachedMetadataHandler* cache_handler) {
+  scoped_refptr<CachedMetadata> module_graph =
+      cache_handler->GetCachedMetadata(
+          V8CodeCache::TagForModuleGraphCodeCache(cache_handler));
+  if (module_graph)
+    AddModuleGraph(root_url, std::move(module_graph));
+}
+
+void ModuleGraphCodeCache::AddModuleGraph(
+    const KURL& root_url,
+    scoped_refptr<CachedMetadata> module_graph) {
+  // The same root module script can be fetched several times.
+  const String root_url_string = root_url.GetString();
+  for (wtf_size_t i = 0; i < module_graphs_.size(); ++i) {
+    if (module_graphs_[i].root_url != root_url_string)
+      continue;
+    if (module_graphs_[i].data == module_graph)
+      return;
+    RemoveModuleGraphAt(i);
+    break;
+  }
+
+  // Only the entries are parsed here. V8 deserializes each code cache when
+  // its module script is compiled.
+  TRACE_EVENT0("v8", "ModuleGraphCodeCache::AddModuleGraph");
+  Vector<Entry> entries;
+  if (!Deserialize(base::make_span(module_graph->Data(), module_graph->size()),
+                   &entries)) {
+    return;
+  }
+  if (module_graphs_.size() == kMaxModuleGraphs)
+    RemoveModuleGraphAt(0);
+  for (const Entry& entry : entries) {
+    code_caches_.Set(entry.url, CodeCache{entry.source_hash, entry.code_cache,
+                                          module_graph.get()});
+  }
+  module_graphs_.push_back(
+      ModuleGraph{root_url_string, std::move(module_graph)});
+}
+
+void ModuleGraphCodeCache::RemoveModuleGraph(const KURL& root_url) {
+  const String root_url_string = root_url.GetString();
+  for (wtf_size_t i = 0; i < module_graphs_.size(); ++i) {
+    if (module_graphs_[i].root_url == root_url_string) {
+      RemoveModuleGraphAt(i);
+      return;
+    }
+  }
+}
+
+void ModuleGraphCodeCache::RemoveModuleGraphAt(wtf_size_t index) {
+  const CachedMetadata* module_graph = module_graphs_[index].data.get();
+  // Entries of module scripts that are also in a later module graph point
+  // into that one instead.
+  Vector<String> urls;
+  for (const auto& it : code_caches_) {
+    if (it.value.module_graph == module_graph)
+      urls.push_back(it.key);
+  }
+  code_caches_.RemoveAll(urls);
+  module_graphs_.EraseAt(index);
+}
+
+std::unique_ptr<v8::ScriptCompiler::CachedData>
+ModuleGraphCodeCache::FindCodeCache(const KURL& source_url,
+                                    uint32_t source_hash) const {
+  base::span<const uint8_t> code_cache =
+      FindCodeCacheData(source_url.GetString(), source_hash);
+  if (code_cache.empty())
+    return nullptr;
+  return std::make_unique<v8::ScriptCompiler::CachedData>(
+      code_cache.data(), base::checked_cast<int>(code_cache.size()),
+      v8::ScriptCompiler::CachedData::BufferNotOwned);
+}
+
+base::span<const uint8_t> ModuleGraphCodeCache::FindCodeCacheData(
+    const String& source_url,
+    uint32_t source_hash) const {
+  auto it = code_caches_.find(source_url);
+  if (it == code_caches_.end() || it->value.source_hash != source_hash)
+    return base::span<const uint8_t>();
+  return it->value.data;
+}
+
+}  // namespace blink
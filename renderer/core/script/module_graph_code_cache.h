@@ -0,0 +1,152 @@
+// Copyright 2020 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef THIRD_PARTY_BLINK_RENDERER_CORE_SCRIPT_MODULE_GRAPH_CODE_CACHE_H_
+#define THIRD_PARTY_BLINK_RENDERER_CORE_SCRIPT_MODULE_GRAPH_CODE_CACHE_H_
+
+#include <stdint.h>
+#include <memory>
+
+#include "base/containers/span.h"
+#include "base/macros.h"
+#include "third_party/blink/renderer/core/core_export.h"
+#include "third_party/blink/renderer/platform/heap/handle.h"
+#include "third_party/blink/renderer/platform/loader/fetch/cached_metadata.h"
+#include "third_party/blink/renderer/platform/weborigin/kurl.h"
+#include "third_party/blink/renderer/platform/wtf/hash_map.h"
+#include "third_party/blink/renderer/platform/wtf/text/string_hash.h"
+#include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
+#include "v8/include/v8.h"
+
+namespace blink {
+
+class ModuleRecordProduceCacheData;
+class SingleCachedMetadataHandler;
+
+// ModuleGraphCodeCache keeps the V8 code caches of whole module graphs.
+//
+// After a module graph has been evaluated, the code caches of its module
+// scripts are stored together, as a single CachedMetadata of the resource of
+// the root module script. When the root module script is fetched again, that
+// CachedMetadata comes with its response, so the code caches of all the
+// descendants are available as soon as they are fetched, regardless of the
+// state of their own resources. Each code cache is validated against a hash
+// of the source text of its module script, and V8 rejects code caches that
+// don't match in any other way.
+//
+// A ModuleGraphCodeCache is owned by a Modulator and holds the module graph
+// code caches of the root module scripts fetched through it, until the graph
+// of each has been evaluated. At most kMaxModuleGraphs are held, so that the
+// graphs that are never evaluated don't pile up.
+class CORE_EXPORT ModuleGraphCodeCache final
+    : public GarbageCollected<ModuleGraphCodeCache> {
+ public:
+  // Collects the code caches of the module scripts of one module graph and
+  // stores them in the CachedMetadata of its root module script.
+  class CORE_EXPORT Builder final {
+    STACK_ALLOCATED();
+
+   public:
+    Builder(const ModuleGraphCodeCache&, const KURL& root_url);
+
+    // Must be called for each module script of the graph before its own code
+    // cache is produced. |produce_cache_data| may be null if it was already
+    // produced.
+    void AddModule(const KURL& source_url,
+                   const ModuleRecordProduceCacheData* produce_cache_data);
+
+    // Stores the module graph code cache in |root_cache_handler|. Does
+    // nothing if all the code caches came from a module graph code cache
+    // already, or if no module script has a code cache yet.
+    void Finish(SingleCachedMetadataHandler* root_cache_handler);
+
+   private:
+    struct Module {
+      DISALLOW_NEW();
+
+     public:
+      void Trace(Visitor* visitor) { visitor->Trace(cache_handler); }
+
+      String url;
+      Member<SingleCachedMetadataHandler> cache_handler;
+      bool consumed_module_graph_code_cache;
+      uint32_t source_hash;
+    };
+
+    const ModuleGraphCodeCache& code_cache_;
+    const String root_url_;
+    HeapVector<Module> modules_;
+
+    DISALLOW_COPY_AND_ASSIGN(Builder);
+  };
+
+  // A code cache in a module graph code cache.
+  struct Entry {
+    String url;
+    uint32_t source_hash;
+    base::span<const uint8_t> code_cache;
+  };
+
+  ModuleGraphCodeCache() = default;
+
+  void Trace(Visitor*) {}
+
+  // The hash of the source text of a module script that code caches are
+  // validated against.
+  static uint32_t SourceHash(const String& source_text);
+
+  static Vector<uint8_t> Serialize(const Vector<Entry>&);
+  // Returns false if |data| is not a well-formed module graph code cache.
+  static bool Deserialize(base::span<const uint8_t> data, Vector<Entry>*);
+
+  static constexpr wtf_size_t kMaxModuleGraphs = 16;
+
+  // Makes the module graph code cache of |cache_handler|, the handler of the
+  // root module script at |root_url|, if any, available to FindCodeCache().
+  // Drops the oldest module graph if there are more than kMaxModuleGraphs.
+  void AddModuleGraphFrom(const KURL& root_url,
+                          const SingleCachedMetadataHandler* cache_handler);
+  void AddModuleGraph(const KURL& root_url, scoped_refptr<CachedMetadata>);
+
+  // Drops the module graph code cache of the root module script at
+  // |root_url|. Called once its graph has been evaluated, as the module map
+  // doesn't compile the module scripts of the graph again.
+  void RemoveModuleGraph(const KURL& root_url);
+
+  // Returns the code cache of the module script at |source_url|, or null if
+  // there is none or if it was produced for a source text with another
+  // SourceHash(). The data is not owned by the returned object and stays
+  // valid as long as this object.
+  std::unique_ptr<v8::ScriptCompiler::CachedData> FindCodeCache(
+      const KURL& source_url,
+      uint32_t source_hash) const;
+
+ private:
+  struct ModuleGraph {
+    String root_url;
+    scoped_refptr<CachedMetadata> data;
+  };
+
+  struct CodeCache {
+    uint32_t source_hash;
+    base::span<const uint8_t> data;
+    // The CachedMetadata of the module graph that |data| points into.
+    const CachedMetadata* module_graph;
+  };
+
+  base::span<const uint8_t> FindCodeCacheData(const String& source_url,
+                                              uint32_t source_hash) const;
+  void RemoveModuleGraphAt(wtf_size_t index);
+
+  // The module graphs that |code_caches_| point into, oldest first.
+  Vector<ModuleGraph> module_graphs_;
+  HashMap<String, CodeCache> code_caches_;
+
+  DISALLOW_COPY_AND_ASSIGN(ModuleGraphCodeCache);
+};
+
+}  // namespace blink
+
+#endif  // THIRD_PARTY_BLINK_RENDERER_CORE_SCRIPT_MODULE_GRAPH_CODE_CACHE_H_
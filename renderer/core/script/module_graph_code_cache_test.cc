@@ -0,0 +1,159 @@
+// Copyright 2020 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/core/script/module_graph_code_cache.h"
+
+#include <string.h>
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/renderer/platform/loader/fetch/cached_metadata.h"
+
+namespace blink {
+
+namespace {
+
+constexpr uint32_t kTag = 42;
+
+const uint8_t kRootCodeCache[] = {1, 2, 3, 4, 5};
+const uint8_t kChildCodeCache[] = {6, 7, 8, 9, 10, 11, 12, 13, 14};
+
+Vector<ModuleGraphCodeCache::Entry> TestEntries() {
+  Vector<ModuleGraphCodeCache::Entry> entries;
+  entries.push_back(ModuleGraphCodeCache::Entry{
+      "https://example.com/root.js", ModuleGraphCodeCache::SourceHash("root"),
+      base::make_span(kRootCodeCache)});
+  entries.push_back(ModuleGraphCodeCache::Entry{
+      "https://example.com/child.js",
+      ModuleGraphCodeCache::SourceHash("child"),
+      base::make_span(kChildCodeCache)});
+  return entries;
+}
+
+scoped_refptr<CachedMetadata> TestModuleGraph() {
+  Vector<uint8_t> data = ModuleGraphCodeCache::Serialize(TestEntries());
+  return CachedMetadata::Create(kTag, data.data(), data.size());
+}
+
+}  // namespace
+
+TEST(ModuleGraphCodeCacheTest, SerializeAndDeserialize) {
+  Vector<uint8_t> data = ModuleGraphCodeCache::Serialize(TestEntries());
+  Vector<ModuleGraphCodeCache::Entry> entries;
+  ASSERT_TRUE(ModuleGraphCodeCache::Deserialize(
+      base::make_span(data.data(), data.size()), &entries));
+  Vector<ModuleGraphCodeCache::Entry> expected = TestEntries();
+  ASSERT_EQ(expected.size(), entries.size());
+  for (wtf_size_t i = 0; i < entries.size(); ++i) {
+    EXPECT_EQ(expected[i].url, entries[i].url);
+    EXPECT_EQ(expected[i].source_hash, entries[i].source_hash);
+    EXPECT_EQ(std::vector<uint8_t>(expected[i].code_cache.begin(),
+                                   expected[i].code_cache.end()),
+              std::vector<uint8_t>(entries[i].code_cache.begin(),
+                                   entries[i].code_cache.end()));
+    // Code caches are aligned so that V8 can use them in place.
+    EXPECT_EQ(0u, (entries[i].code_cache.data() - data.data()) % 8);
+  }
+}
+
+TEST(ModuleGraphCodeCacheTest, DeserializeMalformedData) {
+  Vector<uint8_t> data = ModuleGraphCodeCache::Serialize(TestEntries());
+  Vector<ModuleGraphCodeCache::Entry> entries;
+  for (wtf_size_t size = 0; size < data.size(); ++size) {
+    entries.clear();
+    EXPECT_FALSE(ModuleGraphCodeCache::Deserialize(
+        base::make_span(data.data(), size), &entries));
+  }
+
+  // A huge entry count must not be trusted.
+  data[0] = data[1] = data[2] = data[3] = 0xff;
+  entries.clear();
+  EXPECT_FALSE(ModuleGraphCodeCache::Deserialize(
+      base::make_span(data.data(), data.size()), &entries));
+}
+
+TEST(ModuleGraphCodeCacheTest, FindCodeCache) {
+  auto* code_cache = MakeGarbageCollected<ModuleGraphCodeCache>();
+  const KURL root_url("https://example.com/root.js");
+  const KURL child_url("https://example.com/child.js");
+  const uint32_t root_hash = ModuleGraphCodeCache::SourceHash("root");
+  const uint32_t child_hash = ModuleGraphCodeCache::SourceHash("child");
+  EXPECT_FALSE(code_cache->FindCodeCache(root_url, root_hash));
+
+  code_cache->AddModuleGraph(root_url, TestModuleGraph());
+  std::unique_ptr<v8::ScriptCompiler::CachedData> cached_data =
+      code_cache->FindCodeCache(child_url, child_hash);
+  ASSERT_TRUE(cached_data);
+  EXPECT_EQ(static_cast<int>(sizeof(kChildCodeCache)), cached_data->length);
+  EXPECT_EQ(0, memcmp(kChildCodeCache, cached_data->data,
+                      sizeof(kChildCodeCache)));
+  EXPECT_TRUE(code_cache->FindCodeCache(root_url, root_hash));
+
+  // Code caches produced for another source text are not returned.
+  EXPECT_FALSE(code_cache->FindCodeCache(child_url, root_hash));
+  EXPECT_FALSE(code_cache->FindCodeCache(
+      child_url, ModuleGraphCodeCache::SourceHash("modified child")));
+  EXPECT_FALSE(
+      code_cache->FindCodeCache(KURL("https://example.com/other.js"), 0));
+}
+
+TEST(ModuleGraphCodeCacheTest, IgnoreMalformedModuleGraph) {
+  auto* code_cache = MakeGarbageCollected<ModuleGraphCodeCache>();
+  Vector<uint8_t> data = ModuleGraphCodeCache::Serialize(TestEntries());
+  data.pop_back();
+  code_cache->AddModuleGraph(
+      KURL("https://example.com/root.js"),
+      CachedMetadata::Create(kTag, data.data(), data.size()));
+  EXPECT_FALSE(code_cache->FindCodeCache(
+      KURL("https://example.com/root.js"),
+      ModuleGraphCodeCache::SourceHash("root")));
+}
+
+TEST(ModuleGraphCodeCacheTest, RemoveModuleGraph) {
+  auto* code_cache = MakeGarbageCollected<ModuleGraphCodeCache>();
+  const KURL root_url("https://example.com/root.js");
+  const KURL other_root_url("https://example.com/other.js");
+  const KURL child_url("https://example.com/child.js");
+  const uint32_t root_hash = ModuleGraphCodeCache::SourceHash("root");
+  const uint32_t child_hash = ModuleGraphCodeCache::SourceHash("child");
+
+  code_cache->AddModuleGraph(root_url, TestModuleGraph());
+  code_cache->RemoveModuleGraph(root_url);
+  EXPECT_FALSE(code_cache->FindCodeCache(root_url, root_hash));
+  EXPECT_FALSE(code_cache->FindCodeCache(child_url, child_hash));
+
+  // A module script that is also in a later module graph keeps its code
+  // cache until that one is removed too.
+  Vector<ModuleGraphCodeCache::Entry> entries = TestEntries();
+  entries.EraseAt(0);
+  Vector<uint8_t> data = ModuleGraphCodeCache::Serialize(entries);
+  code_cache->AddModuleGraph(root_url, TestModuleGraph());
+  code_cache->AddModuleGraph(
+      other_root_url, CachedMetadata::Create(kTag, data.data(), data.size()));
+  code_cache->RemoveModuleGraph(root_url);
+  EXPECT_FALSE(code_cache->FindCodeCache(root_url, root_hash));
+  EXPECT_TRUE(code_cache->FindCodeCache(child_url, child_hash));
+  code_cache->RemoveModuleGraph(other_root_url);
+  EXPECT_FALSE(code_cache->FindCodeCache(child_url, child_hash));
+}
+
+TEST(ModuleGraphCodeCacheTest, DropOldestModuleGraph) {
+  auto* code_cache = MakeGarbageCollected<ModuleGraphCodeCache>();
+  const uint32_t root_hash = ModuleGraphCodeCache::SourceHash("root");
+  auto root_url = [](wtf_size_t i) {
+    return KURL("https://example.com/root" + String::Number(i) + ".js");
+  };
+  for (wtf_size_t i = 0; i <= ModuleGraphCodeCache::kMaxModuleGraphs; ++i) {
+    Vector<ModuleGraphCodeCache::Entry> entries = TestEntries();
+    entries[0].url = root_url(i).GetString();
+    Vector<uint8_t> data = ModuleGraphCodeCache::Serialize(entries);
+    code_cache->AddModuleGraph(
+        root_url(i), CachedMetadata::Create(kTag, data.data(), data.size()));
+  }
+  EXPECT_FALSE(code_cache->FindCodeCache(root_url(0), root_hash));
+  for (wtf_size_t i = 1; i <= ModuleGraphCodeCache::kMaxModuleGraphs; ++i)
+    EXPECT_TRUE(code_cache->FindCodeCache(root_url(i), root_hash));
+}
+
+}  // namespace blink
@@ -52,6 +52,11 @@ class CORE_EXPORT ModuleScript : public Script {
   void Trace(Visitor*) override;
 
   virtual void ProduceCache() {}
+  // Returns the parameters for ProduceCache(), or null if there are none or if
+  // ProduceCache() was already called.
+  virtual const ModuleRecordProduceCacheData* GetProduceCacheData() const {
+    return nullptr;
+  }
   const KURL& SourceURL() const { return source_url_; }
 
  protected:
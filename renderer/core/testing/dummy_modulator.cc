@@ -56,6 +56,10 @@ V8CacheOptions DummyModulator::GetV8CacheOptions() const {
   return kV8CacheOptionsDefault;
 }
 
+ModuleGraphCodeCache* DummyModulator::GetModuleGraphCodeCache() {
+  return nullptr;
+}
+
 bool DummyModulator::IsScriptingDisabled() const {
   return false;
 }
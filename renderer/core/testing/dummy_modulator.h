@@ -33,6 +33,7 @@ class DummyModulator : public Modulator {
   base::SingleThreadTaskRunner* TaskRunner() override;
   ScriptState* GetScriptState() override;
   V8CacheOptions GetV8CacheOptions() const override;
+  ModuleGraphCodeCache* GetModuleGraphCodeCache() override;
   bool IsScriptingDisabled() const override;
 
   bool ImportMapsEnabled() const override;
@@ -48,8 +48,8 @@ class CORE_EXPORT DOMArrayBuffer final : public DOMArrayBufferBase {
                                       size_t element_byte_size);
 
   // Only for use by XMLHttpRequest::responseArrayBuffer,
-  // Internals::serializeObject, and
-  // FetchDataLoaderAsArrayBuffer::OnStateChange.
+  // Internals::serializeObject, FetchDataLoaderAsArrayBuffer::OnStateChange
+  // and TextEncoder::encode.
   static DOMArrayBuffer* CreateUninitializedOrNull(size_t num_elements,
                                                    size_t element_byte_size);
 
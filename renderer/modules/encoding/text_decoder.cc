@@ -111,7 +111,8 @@ String TextDecoder::decode(const char* start,
                            const TextDecodeOptions* options,
                            ExceptionState& exception_state) {
   DCHECK(options);
-  if (!do_not_flush_) {
+  const bool stream_start = !do_not_flush_;
+  if (stream_start) {
     codec_ = NewTextCodec(encoding_);
     bom_seen_ = false;
   }
@@ -121,6 +122,19 @@ String TextDecoder::decode(const char* start,
   WTF::FlushBehavior flush = do_not_flush_ ? WTF::FlushBehavior::kDoNotFlush
                                            : WTF::FlushBehavior::kDataEOF;
 
+  // Skip a UTF-8 byte order mark at the start of the stream before decoding,
+  // rather than removing it from the decoded string, which copies the string.
+  // Marks split across chunks are removed below.
+  static constexpr char kUTF8ByteOrderMark[] = "\xEF\xBB\xBF";
+  constexpr uint32_t kUTF8ByteOrderMarkLength = 3;
+  if (!ignore_bom_ && stream_start && length >= kUTF8ByteOrderMarkLength &&
+      !memcmp(start, kUTF8ByteOrderMark, kUTF8ByteOrderMarkLength) &&
+      encoding_ == WTF::UTF8Encoding()) {
+    start += kUTF8ByteOrderMarkLength;
+    length -= kUTF8ByteOrderMarkLength;
+    bom_seen_ = true;
+  }
+
   bool saw_error = false;
   String s = codec_->Decode(start, length, flush, fatal_, saw_error);
 
@@ -32,9 +32,11 @@
 
 #include "third_party/blink/renderer/bindings/modules/v8/v8_text_encoder_encode_into_result.h"
 #include "third_party/blink/renderer/core/execution_context/execution_context.h"
+#include "third_party/blink/renderer/core/typed_arrays/dom_array_buffer.h"
 #include "third_party/blink/renderer/modules/encoding/encoding.h"
 #include "third_party/blink/renderer/platform/bindings/exception_state.h"
 #include "third_party/blink/renderer/platform/wtf/text/text_encoding_registry.h"
+#include "third_party/blink/renderer/platform/wtf/text/utf8.h"
 
 namespace blink {
 
@@ -59,26 +61,32 @@ String TextEncoder::encoding() const {
 }
 
 NotShared<DOMUint8Array> TextEncoder::encode(const String& input) {
-  std::string result;
-  // Note that the UnencodableHandling here is never used since the
-  // only possible encoding is UTF-8, which will use
-  // U+FFFD-replacement rather than ASCII fallback substitution when
-  // unencodable sequences (for instance, unpaired UTF-16 surrogates)
-  // are present in the input.
+  // The result is sized by a first pass over |input| and then encoded into
+  // directly, rather than through an intermediate std::string.
+  const size_t result_length =
+      input.Is8Bit() ? WTF::unicode::CalculateUTF8Length(input.Characters8(),
+                                                         input.length())
+                     : WTF::unicode::CalculateUTF8Length(input.Characters16(),
+                                                         input.length());
+  DOMUint8Array* result =
+      DOMUint8Array::CreateUninitializedOrNull(result_length);
+  if (UNLIKELY(!result))
+    OOM_CRASH(result_length);
+
+  TextCodec::EncodeIntoResult encode_into_result_data;
   if (input.Is8Bit()) {
-    result = codec_->Encode(input.Characters8(), input.length(),
-                            WTF::kNoUnencodables);
+    encode_into_result_data =
+        codec_->EncodeInto(input.Characters8(), input.length(),
+                           result->Data(), result_length);
   } else {
-    result = codec_->Encode(input.Characters16(), input.length(),
-                            WTF::kNoUnencodables);
+    encode_into_result_data =
+        codec_->EncodeInto(input.Characters16(), input.length(),
+                           result->Data(), result_length);
   }
+  DCHECK_EQ(input.length(), encode_into_result_data.code_units_read);
+  DCHECK_EQ(result_length, encode_into_result_data.bytes_written);
 
-  const char* buffer = result.c_str();
-  const unsigned char* unsigned_buffer =
-      reinterpret_cast<const unsigned char*>(buffer);
-
-  return NotShared<DOMUint8Array>(DOMUint8Array::Create(
-      unsigned_buffer, static_cast<unsigned>(result.length())));
+  return NotShared<DOMUint8Array>(result);
 }
 
 TextEncoderEncodeIntoResult* TextEncoder::encodeInto(
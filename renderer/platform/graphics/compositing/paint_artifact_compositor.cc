@@ -375,16 +375,22 @@ void PaintArtifactCompositor::UpdateTouchActionRects(
     if (!hit_test_data || hit_test_data->touch_action_rects.IsEmpty())
       continue;
 
-    const auto& chunk_state = chunk.properties.GetPropertyTreeState();
-    for (const auto& touch_action_rect : hit_test_data->touch_action_rects) {
-      auto rect = FloatClipRect(FloatRect(touch_action_rect.rect));
-      if (!GeometryMapper::LocalToAncestorVisualRect(chunk_state, layer_state,
-                                                     rect)) {
+    // The rects of a chunk share the chunk state, so map them together.
+    const auto& touch_action_rects = hit_test_data->touch_action_rects;
+    Vector<FloatClipRect> rects;
+    rects.ReserveInitialCapacity(touch_action_rects.size());
+    for (const auto& touch_action_rect : touch_action_rects)
+      rects.push_back(FloatClipRect(FloatRect(touch_action_rect.rect)));
+    GeometryMapper::LocalToAncestorVisualRects(
+        chunk.properties.GetPropertyTreeState(), layer_state, rects);
+
+    for (wtf_size_t i = 0; i < rects.size(); ++i) {
+      auto& rect = rects[i];
+      if (rect.Rect().IsEmpty())
         continue;
-      }
       rect.MoveBy(FloatPoint(-layer_offset.x(), -layer_offset.y()));
       touch_action_in_layer_space.Union(
-          touch_action_rect.allowed_touch_action,
+          touch_action_rects[i].allowed_touch_action,
           (gfx::Rect)EnclosingIntRect(rect.Rect()));
     }
   }
@@ -542,14 +548,17 @@ std::unique_ptr<JSONObject> PaintArtifactCompositor::PendingLayer::ToJSON(
   return result;
 }
 
-FloatRect PaintArtifactCompositor::PendingLayer::VisualRectForOverlapTesting()
-    const {
-  FloatClipRect visual_rect(bounds);
-  GeometryMapper::LocalToAncestorVisualRect(
-      property_tree_state, PropertyTreeState::Root(), visual_rect,
-      kIgnorePlatformOverlayScrollbarSize, kNonInclusiveIntersect,
-      kExpandVisualRectForAnimation);
-  return visual_rect.Rect();
+const FloatRect&
+PaintArtifactCompositor::PendingLayer::VisualRectForOverlapTesting() const {
+  if (!cached_visual_rect_for_overlap_testing) {
+    FloatClipRect visual_rect(bounds);
+    GeometryMapper::LocalToAncestorVisualRect(
+        property_tree_state, PropertyTreeState::Root(), visual_rect,
+        kIgnorePlatformOverlayScrollbarSize, kNonInclusiveIntersect,
+        kExpandVisualRectForAnimation);
+    cached_visual_rect_for_overlap_testing = visual_rect.Rect();
+  }
+  return *cached_visual_rect_for_overlap_testing;
 }
 
 bool PaintArtifactCompositor::PendingLayer::Merge(const PendingLayer& guest) {
@@ -562,6 +571,7 @@ bool PaintArtifactCompositor::PendingLayer::Merge(const PendingLayer& guest) {
       UniteRectsKnownToBeOpaque(MapRectKnownToBeOpaque(new_state),
                                 guest.MapRectKnownToBeOpaque(new_state));
   property_tree_state = new_state;
+  cached_visual_rect_for_overlap_testing = base::nullopt;
   return true;
 }
 
@@ -578,6 +588,7 @@ void PaintArtifactCompositor::PendingLayer::Upcast(
 
   rect_known_to_be_opaque = MapRectKnownToBeOpaque(new_state);
   property_tree_state = new_state;
+  cached_visual_rect_for_overlap_testing = base::nullopt;
 }
 
 const PaintChunk& PaintArtifactCompositor::PendingLayer::FirstPaintChunk(
@@ -854,6 +865,70 @@ static bool IsCompositedScrollbar(const DisplayItem& item) {
          scroll_translation->HasDirectCompositingReasons();
 }
 
+static bool ChunkRequiresOwnLayer(const PaintArtifact& paint_artifact,
+                                  const PaintChunk& chunk) {
+  if (IsCompositedScrollHitTest(chunk))
+    return true;
+  if (!chunk.size())
+    return false;
+  const auto& first_display_item =
+      paint_artifact.GetDisplayItemList()[chunk.begin_index];
+  return first_display_item.IsForeignLayer() ||
+         first_display_item.IsGraphicsLayerWrapper() ||
+         IsCompositedScrollbar(first_display_item);
+}
+
+PaintArtifactCompositor::LayerizedChunk::LayerizedChunk(
+    const PaintArtifact& paint_artifact,
+    const PaintChunk& chunk)
+    : id(chunk.id),
+      properties(chunk.properties),
+      bounds(chunk.bounds),
+      size(chunk.size()),
+      known_to_be_opaque(chunk.known_to_be_opaque),
+      requires_own_layer(ChunkRequiresOwnLayer(paint_artifact, chunk)) {}
+
+bool PaintArtifactCompositor::LayerizedChunk::Matches(
+    const PaintArtifact& paint_artifact,
+    const PaintChunk& chunk) const {
+  return chunk.id == id && !chunk.client_is_just_created &&
+         chunk.properties == properties && chunk.bounds == bounds &&
+         chunk.known_to_be_opaque == known_to_be_opaque &&
+         // Only whether the chunk is empty matters for layerization, but the
+         // size also affects the display item ranges of the pending layers.
+         chunk.size() == size &&
+         ChunkRequiresOwnLayer(paint_artifact, chunk) == requires_own_layer;
+}
+
+// Returns true if LayerizeGroup() would produce the same result for
+// |new_artifact| as for the paint chunks summarized in |old_chunks|, i.e. the
+// paint chunks are the same in all aspects that the layerization algorithm
+// looks at, and no paint property node referenced by the chunks has changed.
+bool PaintArtifactCompositor::CanReuseLayerization(
+    const Vector<LayerizedChunk>& old_chunks,
+    const PaintArtifact& new_artifact) {
+  const auto& new_chunks = new_artifact.PaintChunks();
+  if (old_chunks.size() != new_chunks.size())
+    return false;
+
+  const auto& root = PropertyTreeState::Root();
+  // Any change of the property nodes may change overlap testing or merging.
+  constexpr auto kAnyChange =
+      PaintPropertyChangeType::kChangedOnlyCompositedValues;
+  for (wtf_size_t i = 0; i < new_chunks.size(); ++i) {
+    const auto& new_chunk = new_chunks[i];
+    if (!old_chunks[i].Matches(new_artifact, new_chunk))
+      return false;
+
+    const auto& state = new_chunk.properties.GetPropertyTreeState();
+    if (state.Transform().Changed(kAnyChange, root.Transform()) ||
+        state.Clip().Changed(kAnyChange, root, nullptr) ||
+        state.Effect().Changed(kAnyChange, root, nullptr))
+      return false;
+  }
+  return true;
+}
+
 void PaintArtifactCompositor::LayerizeGroup(
     const PaintArtifact& paint_artifact,
     const Settings& settings,
@@ -893,16 +968,8 @@ void PaintArtifactCompositor::LayerizeGroup(
     const auto& chunk_effect = chunk_it->properties.Effect().Unalias();
     if (&chunk_effect == &unaliased_group) {
       // Case A: The next chunk belongs to the current group but no subgroup.
-      bool requires_own_layer = false;
-      if (IsCompositedScrollHitTest(*chunk_it)) {
-        requires_own_layer = true;
-      } else if (chunk_it->size()) {
-        const auto& first_display_item =
-            paint_artifact.GetDisplayItemList()[chunk_it->begin_index];
-        requires_own_layer = first_display_item.IsForeignLayer() ||
-                             first_display_item.IsGraphicsLayerWrapper() ||
-                             IsCompositedScrollbar(first_display_item);
-      }
+      bool requires_own_layer =
+          ChunkRequiresOwnLayer(paint_artifact, *chunk_it);
       DCHECK(!requires_own_layer || chunk_it->size() <= 1u);
 
       pending_layers_.emplace_back(
@@ -959,16 +1026,35 @@ void PaintArtifactCompositor::LayerizeGroup(
 }
 
 void PaintArtifactCompositor::CollectPendingLayers(
-    const PaintArtifact& paint_artifact,
+    scoped_refptr<const PaintArtifact> paint_artifact,
     const Settings& settings) {
+  did_reuse_layerization_ =
+      !layerized_chunks_.IsEmpty() &&
+      layerized_settings_.prefer_compositing_to_lcd_text ==
+          settings.prefer_compositing_to_lcd_text &&
+      CanReuseLayerization(layerized_chunks_, *paint_artifact);
+  TRACE_EVENT1("blink", "PaintArtifactCompositor::CollectPendingLayers",
+               "reuse_layerization", did_reuse_layerization_);
+  if (did_reuse_layerization_) {
+    pending_layers_ = layerized_pending_layers_;
+    return;
+  }
+
   Vector<PaintChunk>::const_iterator cursor =
-      paint_artifact.PaintChunks().begin();
+      paint_artifact->PaintChunks().begin();
   // Shrink, but do not release the backing. Re-use it from the last frame.
   pending_layers_.Shrink(0);
-  LayerizeGroup(paint_artifact, settings, EffectPaintPropertyNode::Root(),
+  LayerizeGroup(*paint_artifact, settings, EffectPaintPropertyNode::Root(),
                 cursor);
-  DCHECK_EQ(paint_artifact.PaintChunks().end(), cursor);
+  DCHECK_EQ(paint_artifact->PaintChunks().end(), cursor);
   pending_layers_.ShrinkToReasonableCapacity();
+
+  layerized_chunks_.clear();
+  layerized_chunks_.ReserveCapacity(paint_artifact->PaintChunks().size());
+  for (const auto& chunk : paint_artifact->PaintChunks())
+    layerized_chunks_.emplace_back(*paint_artifact, chunk);
+  layerized_settings_ = settings;
+  layerized_pending_layers_ = pending_layers_;
 }
 
 void SynthesizedClip::UpdateLayer(bool needs_layer,
@@ -1246,7 +1332,7 @@ void PaintArtifactCompositor::Update(
   PropertyTreeManager property_tree_manager(*this, *host->property_trees(),
                                             *root_layer_, layer_list_builder,
                                             g_s_property_tree_sequence_number);
-  CollectPendingLayers(*paint_artifact, settings);
+  CollectPendingLayers(paint_artifact, settings);
 
   UpdateCompositorViewportProperties(viewport_properties, property_tree_manager,
                                      host);
@@ -1428,11 +1514,19 @@ bool PaintArtifactCompositor::CanDirectlyUpdateProperties() const {
   return root_layer_ && root_layer_->layer_tree_host();
 }
 
+void PaintArtifactCompositor::InvalidateLayerization() {
+  // A directly updated transform may change overlap or merging decisions, and
+  // its change flags are cleared before the next full update.
+  layerized_chunks_.clear();
+  layerized_pending_layers_.clear();
+}
+
 bool PaintArtifactCompositor::DirectlyUpdateCompositedOpacityValue(
     const EffectPaintPropertyNode& effect) {
   // We can only directly-update compositor values if all content associated
   // with the node is known to be composited.
   DCHECK(effect.HasDirectCompositingReasons());
+  InvalidateLayerization();
   if (CanDirectlyUpdateProperties()) {
     return PropertyTreeManager::DirectlyUpdateCompositedOpacityValue(
         *root_layer_->layer_tree_host(), effect);
@@ -1448,6 +1542,7 @@ bool PaintArtifactCompositor::DirectlyUpdateScrollOffsetTransform(
     // CompositeAfterPaint because we cannot query CompositedLayerMapping here.
     DCHECK(transform.HasDirectCompositingReasons());
   }
+  InvalidateLayerization();
   if (CanDirectlyUpdateProperties()) {
     return PropertyTreeManager::DirectlyUpdateScrollOffsetTransform(
         *root_layer_->layer_tree_host(), transform);
@@ -1460,6 +1555,7 @@ bool PaintArtifactCompositor::DirectlyUpdateTransform(
   // We can only directly-update compositor values if all content associated
   // with the node is known to be composited.
   DCHECK(transform.HasDirectCompositingReasons());
+  InvalidateLayerization();
   if (CanDirectlyUpdateProperties()) {
     return PropertyTreeManager::DirectlyUpdateTransform(
         *root_layer_->layer_tree_host(), transform);
@@ -1472,6 +1568,7 @@ bool PaintArtifactCompositor::DirectlyUpdatePageScaleTransform(
   // We can only directly-update compositor values if all content associated
   // with the node is known to be composited.
   DCHECK(transform.HasDirectCompositingReasons());
+  InvalidateLayerization();
   if (CanDirectlyUpdateProperties()) {
     return PropertyTreeManager::DirectlyUpdatePageScaleTransform(
         *root_layer_->layer_tree_host(), transform);
@@ -10,6 +10,7 @@
 #include "base/macros.h"
 #include "base/memory/ptr_util.h"
 #include "base/memory/scoped_refptr.h"
+#include "base/optional.h"
 #include "cc/layers/content_layer_client.h"
 #include "cc/layers/layer_collections.h"
 #include "cc/layers/picture_layer.h"
@@ -119,6 +120,13 @@ class SynthesizedClip : private cc::ContentLayerClient {
 //
 // PaintArtifactCompositor is the successor to PaintLayerCompositor, reflecting
 // the new home of compositing decisions after paint with CompositeAfterPaint.
+//
+// Layerization, i.e. the grouping of paint chunks into pending layers, is
+// reused as a whole when no paint chunk changed in a way that layerization
+// looks at. Otherwise the whole paint artifact is layerized again. Layerizing
+// only the effect subtrees whose chunks changed would need the result of each
+// LayerizeGroup() call, and the overlap state at its start, to be kept per
+// effect node; that is left for later.
 class PLATFORM_EXPORT PaintArtifactCompositor final
     : private PropertyTreeManagerClient {
   USING_FAST_MALLOC(PaintArtifactCompositor);
@@ -265,7 +273,10 @@ class PLATFORM_EXPORT PaintArtifactCompositor final
 
     std::unique_ptr<JSONObject> ToJSON(const PaintArtifact* = nullptr) const;
 
-    FloatRect VisualRectForOverlapTesting() const;
+    // Returns the bounds mapped into the root property tree state. The result
+    // is cached because the same layer is tested against many other layers
+    // during layerization. The cache is cleared by Merge() and Upcast().
+    const FloatRect& VisualRectForOverlapTesting() const;
 
     bool MayDrawContent(const PaintArtifact&) const;
 
@@ -275,6 +286,7 @@ class PLATFORM_EXPORT PaintArtifactCompositor final
     Vector<wtf_size_t> paint_chunk_indices;
     PropertyTreeState property_tree_state;
     FloatPoint offset_of_decomposited_transforms;
+    mutable base::Optional<FloatRect> cached_visual_rect_for_overlap_testing;
 
     enum {
       kRequiresOwnLayer,
@@ -287,7 +299,10 @@ class PLATFORM_EXPORT PaintArtifactCompositor final
 
   // Collects the PaintChunks into groups which will end up in the same
   // cc layer. This is the entry point of the layerization algorithm.
-  void CollectPendingLayers(const PaintArtifact&, const Settings& settings);
+  // If the paint chunks haven't changed in any way affecting layerization
+  // since the last call, reuses the previous layerization result.
+  void CollectPendingLayers(scoped_refptr<const PaintArtifact>,
+                            const Settings& settings);
 
   // This is the internal recursion of collectPendingLayers. This function
   // loops over the list of paint chunks, scoped by an isolated group
@@ -373,6 +388,10 @@ class PLATFORM_EXPORT PaintArtifactCompositor final
 
   bool CanDirectlyUpdateProperties() const;
 
+  // Called by the direct updates of property nodes, which the next full
+  // update can't see among the changes of the nodes.
+  void InvalidateLayerization();
+
   CompositingReasons GetCompositingReasons(const PendingLayer& layer,
                                            const PendingLayer* previous_layer,
                                            const PaintArtifact&) const;
@@ -398,6 +417,31 @@ class PLATFORM_EXPORT PaintArtifactCompositor final
 
   Vector<PendingLayer, 0> pending_layers_;
 
+  // What layerization looks at in a paint chunk. Keeping this instead of the
+  // last PaintArtifact avoids keeping its display items alive.
+  struct LayerizedChunk {
+    LayerizedChunk(const PaintArtifact&, const PaintChunk&);
+    bool Matches(const PaintArtifact&, const PaintChunk&) const;
+
+    PaintChunk::Id id;
+    RefCountedPropertyTreeState properties;
+    IntRect bounds;
+    wtf_size_t size;
+    bool known_to_be_opaque;
+    bool requires_own_layer;
+  };
+  static bool CanReuseLayerization(const Vector<LayerizedChunk>& old_chunks,
+                                   const PaintArtifact& new_artifact);
+
+  // The input and the result of the last layerization in
+  // CollectPendingLayers(), before the pending layers are modified by
+  // DecompositeTransforms() and Update(). Empty if the layerization can't be
+  // reused.
+  Vector<LayerizedChunk> layerized_chunks_;
+  Settings layerized_settings_;
+  Vector<PendingLayer, 0> layerized_pending_layers_;
+  bool did_reuse_layerization_ = false;
+
   friend class StubChromeClientForCAP;
   friend class PaintArtifactCompositorTest;
 
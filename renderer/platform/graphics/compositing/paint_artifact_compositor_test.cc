@@ -238,6 +238,10 @@ class PaintArtifactCompositorTest : public testing::Test,
     return paint_artifact_compositor_->SynthesizedClipLayersForTesting()[index];
   }
 
+  bool DidReuseLayerization() const {
+    return paint_artifact_compositor_->did_reuse_layerization_;
+  }
+
   // Return the index of |layer| in the root layer list, or -1 if not found.
   int LayerIndex(const cc::Layer* layer) {
     int i = 0;
@@ -273,6 +277,12 @@ class PaintArtifactCompositorTest : public testing::Test,
     return PaintArtifactCompositor::MightOverlap(a, b);
   }
 
+  // Only layerizes |artifact|, and returns the number of pending layers.
+  wtf_size_t CollectPendingLayers(scoped_refptr<const PaintArtifact> artifact) {
+    paint_artifact_compositor_->CollectPendingLayers(artifact, Settings());
+    return paint_artifact_compositor_->pending_layers_.size();
+  }
+
   MockScrollCallbacks& ScrollCallbacks() { return scroll_callbacks_; }
 
   PaintArtifactCompositor& GetPaintArtifactCompositor() {
@@ -1957,6 +1967,151 @@ TEST_P(PaintArtifactCompositorTest, MightOverlap) {
   }
 }
 
+TEST_P(PaintArtifactCompositorTest, VisualRectForOverlapTestingAfterMerge) {
+  PaintChunk paint_chunk = DefaultChunk();
+  paint_chunk.bounds = IntRect(0, 0, 100, 100);
+  PendingLayer pending_layer(paint_chunk, 0, false);
+  EXPECT_EQ(FloatRect(0, 0, 100, 100),
+            pending_layer.VisualRectForOverlapTesting());
+
+  PaintChunk paint_chunk2 = DefaultChunk();
+  paint_chunk2.bounds = IntRect(100, 0, 100, 100);
+  PendingLayer pending_layer2(paint_chunk2, 1, false);
+  ASSERT_TRUE(pending_layer.Merge(pending_layer2));
+  // The cached visual rect should be updated for the merged bounds.
+  EXPECT_EQ(FloatRect(0, 0, 200, 100),
+            pending_layer.VisualRectForOverlapTesting());
+}
+
+#if DCHECK_IS_ON()
+// Each pending layer is mapped to the root property tree state once for
+// overlap testing, not once for each layer it is tested against.
+TEST_P(PaintArtifactCompositorTest, OverlapTestingWithManyChunks) {
+  auto count_geometry_mapper_lookups = [this](wtf_size_t chunk_count) {
+    // Composited transforms prevent merging, and the layers don't overlap, so
+    // each layer is tested against all previous layers.
+    Vector<scoped_refptr<TransformPaintPropertyNode>> transforms;
+    TestPaintArtifact artifact;
+    for (wtf_size_t i = 0; i < chunk_count; ++i) {
+      transforms.push_back(CreateTransform(
+          t0(), TransformationMatrix().Translate(20 * i, 0), FloatPoint3D(),
+          CompositingReason::k3DTransform));
+      artifact.Chunk(*transforms.back(), c0(), e0())
+          .RectDrawing(IntRect(0, 0, 10, 10), Color::kBlack);
+    }
+    GeometryMapper::ClearCache();
+    GeometryMapper::ResetCacheStatisticsForTesting();
+    EXPECT_EQ(chunk_count, CollectPendingLayers(artifact.Build()));
+    auto statistics = GeometryMapper::GetCacheStatisticsForTesting();
+    return statistics.transform_cache_hits + statistics.transform_cache_misses +
+           statistics.clip_cache_hits + statistics.clip_cache_misses;
+  };
+
+  size_t lookups = count_geometry_mapper_lookups(200);
+  EXPECT_LT(0u, lookups);
+  // Mapping the layers for each pair would quadruple the lookups.
+  EXPECT_LT(count_geometry_mapper_lookups(400), 3 * lookups);
+}
+#endif
+
+TEST_P(PaintArtifactCompositorTest, ReuseLayerizationForUnchangedChunks) {
+  auto t1 = Create2DTranslation(t0(), 10, 20);
+  auto build_artifact = [&t1](const IntRect& rect) {
+    return TestPaintArtifact()
+        .Chunk(1)
+        .Properties(*t1, c0(), e0())
+        .RectDrawing(rect, Color::kBlack)
+        .Chunk(2)
+        .Properties(t0(), c0(), e0())
+        .RectDrawing(IntRect(0, 0, 50, 50), Color::kWhite)
+        .Build();
+  };
+
+  Update(build_artifact(IntRect(100, 100, 200, 100)));
+  EXPECT_FALSE(DidReuseLayerization());
+  ASSERT_EQ(1u, LayerCount());
+
+  // Same chunks and unchanged property nodes.
+  t1->ClearChangedToRoot();
+  Update(build_artifact(IntRect(100, 100, 200, 100)));
+  EXPECT_TRUE(DidReuseLayerization());
+  ASSERT_EQ(1u, LayerCount());
+
+  // Changed chunk bounds.
+  Update(build_artifact(IntRect(100, 100, 300, 100)));
+  EXPECT_FALSE(DidReuseLayerization());
+
+  // Changed settings.
+  Settings settings;
+  settings.prefer_compositing_to_lcd_text = true;
+  Update(build_artifact(IntRect(100, 100, 300, 100)), ViewportProperties(),
+         settings);
+  EXPECT_FALSE(DidReuseLayerization());
+
+  // Changed property node.
+  t1->Update(t0(), TransformPaintPropertyNode::State{FloatSize(20, 30)});
+  Update(build_artifact(IntRect(100, 100, 300, 100)), ViewportProperties(),
+         settings);
+  EXPECT_FALSE(DidReuseLayerization());
+  ASSERT_EQ(1u, LayerCount());
+}
+
+TEST_P(PaintArtifactCompositorTest, DirectUpdateInvalidatesLayerization) {
+  auto t1 = CreateAnimatingTransform(t0());
+  auto artifact = TestPaintArtifact()
+                      .Chunk(1)
+                      .Properties(*t1, c0(), e0())
+                      .RectDrawing(IntRect(100, 100, 200, 100), Color::kBlack)
+                      .Chunk(2)
+                      .Properties(t0(), c0(), e0())
+                      .RectDrawing(IntRect(0, 0, 50, 50), Color::kWhite)
+                      .Build();
+  Update(artifact);
+  t1->ClearChangedToRoot();
+  Update(artifact);
+  EXPECT_TRUE(DidReuseLayerization());
+
+  // The change flags of a directly updated node are cleared before the next
+  // full update, which therefore must not reuse the layerization.
+  TransformPaintPropertyNode::State state{FloatSize(300, 0)};
+  state.direct_compositing_reasons =
+      CompositingReason::kActiveTransformAnimation;
+  state.compositor_element_id = t1->GetCompositorElementId();
+  t1->Update(t0(), std::move(state));
+  GetPaintArtifactCompositor().DirectlyUpdateTransform(*t1);
+  t1->ClearChangedToRoot();
+  Update(artifact);
+  EXPECT_FALSE(DidReuseLayerization());
+}
+
+TEST_P(PaintArtifactCompositorTest, TouchActionRegion) {
+  // Pre-CompositeAfterPaint updates touch action regions through
+  // ScrollingCoordinator.
+  if (!RuntimeEnabledFeatures::CompositeAfterPaintEnabled())
+    return;
+
+  auto t1 = Create2DTranslation(t0(), 10, 20);
+  auto c1 = CreateClip(c0(), t0(), FloatRoundedRect(0, 0, 100, 100));
+  TestPaintArtifact artifact;
+  artifact.Chunk()
+      .RectDrawing(IntRect(0, 0, 200, 200), Color::kWhite)
+      .Chunk(*t1, *c1, e0())
+      .RectDrawing(IntRect(0, 0, 100, 100), Color::kBlack)
+      .HitTestTouchAction(IntRect(0, 0, 50, 50), TouchAction::kPanX)
+      .HitTestTouchAction(IntRect(80, 0, 50, 50), TouchAction::kPanY)
+      .HitTestTouchAction(IntRect(200, 200, 10, 10), TouchAction::kNone);
+  Update(artifact.Build());
+
+  ASSERT_EQ(1u, LayerCount());
+  const auto& region = LayerAt(0)->touch_action_region();
+  EXPECT_EQ(cc::Region(gfx::Rect(10, 20, 50, 50)),
+            region.GetRegionForTouchAction(TouchAction::kPanX));
+  EXPECT_EQ(cc::Region(gfx::Rect(90, 20, 10, 50)),
+            region.GetRegionForTouchAction(TouchAction::kPanY));
+  // Clipped out.
+  EXPECT_TRUE(region.GetRegionForTouchAction(TouchAction::kNone).IsEmpty());
+}
+
 TEST_P(PaintArtifactCompositorTest, UniteRectsKnownToBeOpaque) {
   // X aligned and intersect: unite.
   EXPECT_EQ(FloatRect(10, 20, 30, 60),
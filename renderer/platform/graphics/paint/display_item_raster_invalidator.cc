@@ -4,6 +4,7 @@
 
 #include "third_party/blink/renderer/platform/graphics/paint/display_item_raster_invalidator.h"
 
+#include "third_party/blink/renderer/platform/graphics/paint/drawing_display_item.h"
 #include "third_party/blink/renderer/platform/graphics/paint/paint_artifact.h"
 
 namespace blink {
@@ -55,6 +56,18 @@ void DisplayItemRasterInvalidator::Generate() {
 
     const auto& old_item =
         old_paint_artifact_.GetDisplayItemList()[matched_old_index];
+    if (reason != PaintInvalidationReason::kNone &&
+        matched_old_index >= max_cached_old_index && new_item.IsDrawing() &&
+        old_item.IsDrawing() &&
+        new_item.Client().PartialInvalidationVisualRect().IsEmpty() &&
+        static_cast<const DrawingDisplayItem&>(new_item).SharesRecordWith(
+            static_cast<const DrawingDisplayItem&>(old_item))) {
+      // The client was invalidated, but PaintController found that the
+      // repainted display item is identical to the old one (see
+      // PaintController::ReuseIdenticalPaintRecords()).
+      reason = PaintInvalidationReason::kNone;
+    }
+
     if (reason != PaintInvalidationReason::kNone &&
         (old_item.DrawsContent() || new_item.DrawsContent())) {
       // The display item reordered, skipped cache or changed. Will invalidate
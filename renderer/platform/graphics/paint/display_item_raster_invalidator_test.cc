@@ -6,11 +6,15 @@
 
 #include "base/bind_helpers.h"
 #include "testing/gmock/include/gmock/gmock.h"
+#include "third_party/blink/renderer/platform/graphics/paint/drawing_display_item.h"
 #include "third_party/blink/renderer/platform/graphics/paint/paint_artifact.h"
 #include "third_party/blink/renderer/platform/graphics/paint/paint_controller_test.h"
+#include "third_party/blink/renderer/platform/graphics/paint/paint_image.h"
 #include "third_party/blink/renderer/platform/testing/paint_property_test_helpers.h"
 #include "third_party/blink/renderer/platform/testing/paint_test_configurations.h"
 #include "third_party/blink/renderer/platform/testing/test_paint_artifact.h"
+#include "third_party/skia/include/core/SkBitmap.h"
+#include "third_party/skia/include/core/SkImage.h"
 
 namespace blink {
 
@@ -639,4 +643,73 @@ TEST_P(DisplayItemRasterInvalidatorTest, Partial) {
   invalidator_.SetTracksRasterInvalidations(false);
 }
 
+TEST_P(DisplayItemRasterInvalidatorTest, ReuseIdenticalPaintRecord) {
+  ScopedPaintRecordReuseForTest enable_record_reuse(true);
+  FakeDisplayItemClient unchanged("unchanged", IntRect(100, 100, 100, 100));
+  FakeDisplayItemClient changed("changed", IntRect(300, 300, 10, 10));
+  GraphicsContext context(GetPaintController());
+
+  InitRootChunk();
+  DrawRect(context, unchanged, kBackgroundType, FloatRect(100, 100, 100, 100));
+  DrawRect(context, changed, kBackgroundType, FloatRect(300, 300, 10, 10));
+  GenerateRasterInvalidations();
+  auto old_record = static_cast<const DrawingDisplayItem&>(
+                        GetPaintController().GetDisplayItemList()[0])
+                        .GetPaintRecord();
+
+  invalidator_.SetTracksRasterInvalidations(true);
+  InitRootChunk();
+  // |unchanged| is invalidated, but repaints the same content.
+  unchanged.Invalidate(PaintInvalidationReason::kStyle);
+  changed.Invalidate(PaintInvalidationReason::kStyle);
+  DrawRect(context, unchanged, kBackgroundType, FloatRect(100, 100, 100, 100));
+  context.SetFillColor(Color(0, 0, 255));
+  DrawRect(context, changed, kBackgroundType, FloatRect(300, 300, 10, 10));
+
+  EXPECT_THAT(GenerateRasterInvalidations(),
+              UnorderedElementsAre(RasterInvalidationInfo{
+                  &changed, "changed", IntRect(300, 300, 10, 10),
+                  PaintInvalidationReason::kStyle}));
+  EXPECT_EQ(old_record, static_cast<const DrawingDisplayItem&>(
+                            GetPaintController().GetDisplayItemList()[0])
+                            .GetPaintRecord());
+  invalidator_.SetTracksRasterInvalidations(false);
+}
+
+TEST_P(DisplayItemRasterInvalidatorTest, DontReuseRecordOfChangedImage) {
+  ScopedPaintRecordReuseForTest enable_record_reuse(true);
+  FakeDisplayItemClient client("image", IntRect(100, 100, 10, 10));
+  GraphicsContext context(GetPaintController());
+  const PaintImage::Id image_id = PaintImage::GetNextId();
+  auto draw_image = [&](SkColor color) {
+    SkBitmap bitmap;
+    bitmap.allocN32Pixels(10, 10);
+    bitmap.eraseColor(color);
+    PaintImage image = PaintImageBuilder::WithDefault()
+                           .set_id(image_id)
+                           .set_image(SkImage::MakeFromBitmap(bitmap),
+                                      PaintImage::GetNextContentId())
+                           .TakePaintImage();
+    DrawingRecorder recorder(context, client, kBackgroundType);
+    context.Canvas()->drawImage(image, 100, 100);
+  };
+
+  InitRootChunk();
+  draw_image(SK_ColorRED);
+  GenerateRasterInvalidations();
+
+  invalidator_.SetTracksRasterInvalidations(true);
+  InitRootChunk();
+  // The image is drawn with the same ops at the same place, but its content
+  // has changed.
+  client.Invalidate(PaintInvalidationReason::kImage);
+  draw_image(SK_ColorGREEN);
+
+  EXPECT_THAT(GenerateRasterInvalidations(),
+              UnorderedElementsAre(RasterInvalidationInfo{
+                  &client, "image", IntRect(100, 100, 10, 10),
+                  PaintInvalidationReason::kImage}));
+  invalidator_.SetTracksRasterInvalidations(false);
+}
+
 }  // namespace blink
@@ -78,6 +78,67 @@ bool DrawingDisplayItem::Equals(const DisplayItem& other) const {
   return BitmapsEqual(std::move(record), std::move(other_record), bounds);
 }
 
+// Returns true if PaintOpBuffer::operator==() tells whether |record| and
+// another record raster the same. It doesn't for ops that refer to content
+// such as images, text blobs, nested records or shaders, which are compared
+// by geometry and identity, not by what they draw.
+static bool IsComparableByValue(const PaintRecord& record) {
+  for (cc::PaintOpBuffer::Iterator it(&record); it; ++it) {
+    const auto* op = *it;
+    switch (op->GetType()) {
+      case cc::PaintOpType::ClipPath:
+      case cc::PaintOpType::ClipRect:
+      case cc::PaintOpType::ClipRRect:
+      case cc::PaintOpType::Concat:
+      case cc::PaintOpType::DrawArc:
+      case cc::PaintOpType::DrawColor:
+      case cc::PaintOpType::DrawDRRect:
+      case cc::PaintOpType::DrawIRect:
+      case cc::PaintOpType::DrawLine:
+      case cc::PaintOpType::DrawOval:
+      case cc::PaintOpType::DrawPath:
+      case cc::PaintOpType::DrawRect:
+      case cc::PaintOpType::DrawRRect:
+      case cc::PaintOpType::Noop:
+      case cc::PaintOpType::Restore:
+      case cc::PaintOpType::Rotate:
+      case cc::PaintOpType::Save:
+      case cc::PaintOpType::SaveLayer:
+      case cc::PaintOpType::SaveLayerAlpha:
+      case cc::PaintOpType::Scale:
+      case cc::PaintOpType::SetMatrix:
+      case cc::PaintOpType::Translate:
+        break;
+      default:
+        return false;
+    }
+    if (op->IsPaintOpWithFlags()) {
+      const auto& flags = static_cast<const cc::PaintOpWithFlags*>(op)->flags;
+      if (flags.getShader() || flags.getImageFilter())
+        return false;
+    }
+  }
+  return true;
+}
+
+bool DrawingDisplayItem::ReuseRecordIfIdentical(
+    const DrawingDisplayItem& old_item) {
+  DCHECK_EQ(GetId(), old_item.GetId());
+  if (!record_ || !old_item.record_)
+    return false;
+  if (record_ == old_item.record_)
+    return true;
+  if (VisualRect() != old_item.VisualRect())
+    return false;
+  // Unlike Equals(), don't fall back to comparing rasterized bitmaps which is
+  // too slow for the non-debug paint path.
+  if (record_->size() != old_item.record_->size() ||
+      !IsComparableByValue(*record_) || !(*record_ == *old_item.record_))
+    return false;
+  record_ = old_item.record_;
+  return true;
+}
+
 SkColor DrawingDisplayItem::BackgroundColor() const {
   if (GetType() != DisplayItem::kBoxDecorationBackground &&
       GetType() != DisplayItem::kDocumentBackground &&
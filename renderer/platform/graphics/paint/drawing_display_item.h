@@ -36,6 +36,21 @@ class PLATFORM_EXPORT DrawingDisplayItem : public DisplayItem {
 
   bool Equals(const DisplayItem& other) const final;
 
+  // If |old_item| has the same visual rect and a PaintRecord identical
+  // byte-for-byte to ours, replaces our record with the one of |old_item| so
+  // that the two items share the same PaintRecord, and returns true. Records
+  // with ops that draw other content, such as images, are only reused if they
+  // are the same PaintRecord already, because their content may change while
+  // the ops stay the same.
+  bool ReuseRecordIfIdentical(const DrawingDisplayItem& old_item);
+
+  // Returns true if this item and |other| share the same PaintRecord and
+  // visual rect, which means that they produce the same raster result.
+  bool SharesRecordWith(const DrawingDisplayItem& other) const {
+    return record_ && record_ == other.record_ &&
+           VisualRect() == other.VisualRect();
+  }
+
   bool KnownToBeOpaque() const {
     if (!RuntimeEnabledFeatures::CompositeAfterPaintEnabled())
       return false;
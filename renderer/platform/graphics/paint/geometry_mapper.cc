@@ -297,6 +297,75 @@ bool GeometryMapper::SlowLocalToAncestorVisualRectWithEffects(
   return intersects;
 }
 
+void GeometryMapper::LocalToAncestorVisualRects(
+    const PropertyTreeState& local_state,
+    const PropertyTreeState& ancestor_state,
+    Vector<FloatClipRect>& mapping_rects,
+    OverlayScrollbarClipBehavior clip_behavior,
+    ExpandVisualRectForAnimationOrNot expand_for_animation) {
+  if (mapping_rects.IsEmpty() || local_state == ancestor_state)
+    return;
+
+  if (&local_state.Effect().Unalias() != &ancestor_state.Effect().Unalias()) {
+    // Pixel-moving filters are applied on the mapped rect, so the rects can't
+    // share the projection and clip.
+    for (auto& rect : mapping_rects) {
+      LocalToAncestorVisualRect(local_state, ancestor_state, rect,
+                                clip_behavior, kNonInclusiveIntersect,
+                                expand_for_animation);
+    }
+    return;
+  }
+
+  bool has_animation = false;
+  bool success = false;
+  const auto& translation_2d_or_matrix = SourceToDestinationProjectionInternal(
+      local_state.Transform(), ancestor_state.Transform(), has_animation,
+      success);
+  if (!success) {
+    // See LocalToAncestorVisualRectInternal() for the failure condition.
+    for (auto& rect : mapping_rects)
+      rect = FloatClipRect(FloatRect());
+    return;
+  }
+
+  FloatClipRect clip_rect = LocalToAncestorClipRectInternal(
+      local_state.Clip(), ancestor_state.Clip(), ancestor_state.Transform(),
+      clip_behavior, kNonInclusiveIntersect, expand_for_animation, success);
+  // See LocalToAncestorVisualRectInternal() for the pre-CompositeAfterPaint
+  // failure condition.
+  DCHECK(success || !RuntimeEnabledFeatures::CompositeAfterPaintEnabled());
+
+  if (has_animation && expand_for_animation == kExpandVisualRectForAnimation) {
+    // TODO(crbug.com/1026653): Use animation bounds instead of infinite rect.
+    for (auto& rect : mapping_rects) {
+      rect = InfiniteLooseFloatClipRect();
+      if (success)
+        rect.Intersect(clip_rect);
+      else
+        rect.ClearIsTight();
+    }
+    return;
+  }
+
+  if (translation_2d_or_matrix.IsIdentityOr2DTranslation()) {
+    // This is the common case. Keep the loop simple.
+    FloatPoint offset(translation_2d_or_matrix.Translation2D());
+    for (auto& rect : mapping_rects)
+      rect.MoveBy(offset);
+  } else {
+    for (auto& rect : mapping_rects)
+      rect.Map(translation_2d_or_matrix.Matrix());
+  }
+
+  for (auto& rect : mapping_rects) {
+    if (success)
+      rect.Intersect(clip_rect);
+    else
+      rect.ClearIsTight();
+  }
+}
+
 FloatClipRect GeometryMapper::LocalToAncestorClipRect(
     const PropertyTreeState& local_state,
     const PropertyTreeState& ancestor_state,
@@ -443,4 +512,23 @@ void GeometryMapper::ClearCache() {
   GeometryMapperClipCache::ClearCache();
 }
 
+#if DCHECK_IS_ON()
+GeometryMapper::CacheStatistics GeometryMapper::GetCacheStatisticsForTesting() {
+  CacheStatistics statistics;
+  const auto& transform_statistics =
+      GeometryMapperTransformCache::GetStatistics();
+  statistics.transform_cache_hits = transform_statistics.hits;
+  statistics.transform_cache_misses = transform_statistics.misses;
+  const auto& clip_statistics = GeometryMapperClipCache::GetStatistics();
+  statistics.clip_cache_hits = clip_statistics.hits;
+  statistics.clip_cache_misses = clip_statistics.misses;
+  return statistics;
+}
+
+void GeometryMapper::ResetCacheStatisticsForTesting() {
+  GeometryMapperTransformCache::ResetStatistics();
+  GeometryMapperClipCache::ResetStatistics();
+}
+#endif
+
 }  // namespace blink
@@ -12,6 +12,7 @@
 #include "third_party/blink/renderer/platform/transforms/transformation_matrix.h"
 #include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
 #include "third_party/blink/renderer/platform/wtf/hash_map.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
 
 namespace blink {
 
@@ -242,8 +243,37 @@ class PLATFORM_EXPORT GeometryMapper {
       InclusiveIntersectOrNot = kNonInclusiveIntersect,
       ExpandVisualRectForAnimationOrNot = kDontExpandVisualRectForAnimation);
 
+  // Same as LocalToAncestorVisualRect() with kNonInclusiveIntersect, but maps
+  // all rects in |mapping_rects| which share the same |local_state| and
+  // |ancestor_state|. The projection and the clip between the two states are
+  // resolved once, so this is faster than calling LocalToAncestorVisualRect()
+  // for each rect. Each mapped rect is empty if it doesn't intersect with the
+  // clip.
+  static void LocalToAncestorVisualRects(
+      const PropertyTreeState& local_state,
+      const PropertyTreeState& ancestor_state,
+      Vector<FloatClipRect>& mapping_rects,
+      OverlayScrollbarClipBehavior = kIgnorePlatformOverlayScrollbarSize,
+      ExpandVisualRectForAnimationOrNot = kDontExpandVisualRectForAnimation);
+
   static void ClearCache();
 
+#if DCHECK_IS_ON()
+  // Counts of lookups in GeometryMapperTransformCache and
+  // GeometryMapperClipCache since the last ResetCacheStatisticsForTesting().
+  // A miss of the transform cache means that the cache of a transform node was
+  // updated. Only counted with DCHECK_IS_ON() so that release builds don't pay
+  // for it.
+  struct CacheStatistics {
+    size_t transform_cache_hits = 0;
+    size_t transform_cache_misses = 0;
+    size_t clip_cache_hits = 0;
+    size_t clip_cache_misses = 0;
+  };
+  static CacheStatistics GetCacheStatisticsForTesting();
+  static void ResetCacheStatisticsForTesting();
+#endif
+
  private:
   // The internal methods do the same things as their public counterparts, but
   // take an extra |success| parameter which indicates if the function is
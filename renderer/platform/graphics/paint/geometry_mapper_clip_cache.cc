@@ -13,6 +13,10 @@ namespace blink {
 // s_clipCacheGeneration.
 static unsigned g_clip_cache_generation = 0;
 
+#if DCHECK_IS_ON()
+static GeometryMapperClipCache::Statistics g_clip_cache_statistics;
+#endif
+
 GeometryMapperClipCache::GeometryMapperClipCache()
     : cache_generation_(g_clip_cache_generation) {}
 
@@ -20,6 +24,17 @@ void GeometryMapperClipCache::ClearCache() {
   g_clip_cache_generation++;
 }
 
+#if DCHECK_IS_ON()
+const GeometryMapperClipCache::Statistics&
+GeometryMapperClipCache::GetStatistics() {
+  return g_clip_cache_statistics;
+}
+
+void GeometryMapperClipCache::ResetStatistics() {
+  g_clip_cache_statistics = Statistics();
+}
+#endif
+
 bool GeometryMapperClipCache::IsValid() const {
   return cache_generation_ == g_clip_cache_generation;
 }
@@ -35,10 +50,22 @@ const GeometryMapperClipCache::ClipCacheEntry*
 GeometryMapperClipCache::GetCachedClip(
     const ClipAndTransform& clip_and_transform) {
   InvalidateCacheIfNeeded();
+  const auto* entry = FindCachedClip(clip_and_transform);
+#if DCHECK_IS_ON()
+  if (entry)
+    ++g_clip_cache_statistics.hits;
+  else
+    ++g_clip_cache_statistics.misses;
+#endif
+  return entry;
+}
+
+const GeometryMapperClipCache::ClipCacheEntry*
+GeometryMapperClipCache::FindCachedClip(
+    const ClipAndTransform& clip_and_transform) const {
   for (const auto& entry : clip_cache_) {
-    if (entry.clip_and_transform == clip_and_transform) {
+    if (entry.clip_and_transform == clip_and_transform)
       return &entry;
-    }
   }
   return nullptr;
 }
@@ -46,7 +73,7 @@ GeometryMapperClipCache::GetCachedClip(
 void GeometryMapperClipCache::SetCachedClip(const ClipCacheEntry& entry) {
   InvalidateCacheIfNeeded();
   // There should be no existing entry.
-  DCHECK(!GetCachedClip(entry.clip_and_transform));
+  DCHECK(!FindCachedClip(entry.clip_and_transform));
   clip_cache_.push_back(entry);
 }
 
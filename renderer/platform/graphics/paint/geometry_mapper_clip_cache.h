@@ -67,8 +67,20 @@ class PLATFORM_EXPORT GeometryMapperClipCache {
   static void ClearCache();
   bool IsValid() const;
 
+#if DCHECK_IS_ON()
+  // Counts of GetCachedClip() calls which found (hits) or didn't find (misses)
+  // a cached clip, for GeometryMapper::GetCacheStatisticsForTesting().
+  struct Statistics {
+    size_t hits = 0;
+    size_t misses = 0;
+  };
+  static const Statistics& GetStatistics();
+  static void ResetStatistics();
+#endif
+
  private:
   void InvalidateCacheIfNeeded();
+  const ClipCacheEntry* FindCachedClip(const ClipAndTransform&) const;
 
   Vector<ClipCacheEntry> clip_cache_;
   unsigned cache_generation_;
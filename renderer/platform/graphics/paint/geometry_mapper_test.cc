@@ -43,6 +43,7 @@ class GeometryMapperTest : public testing::Test,
 
   void CheckMappings();
   void CheckLocalToAncestorVisualRect();
+  void CheckLocalToAncestorVisualRects();
   void CheckLocalToAncestorClipRect();
   void CheckSourceToDestinationRect();
   void CheckSourceToDestinationProjection();
@@ -103,6 +104,31 @@ void GeometryMapperTest::CheckLocalToAncestorVisualRect() {
                       actual_visual_rect);
 }
 
+void GeometryMapperTest::CheckLocalToAncestorVisualRects() {
+  // Each rect mapped in batch should be the same as mapped individually.
+  Vector<FloatRect> input_rects = {input_rect, FloatRect(),
+                                   FloatRect(-1000, -1000, 10, 10)};
+  input_rects.push_back(input_rect);
+  input_rects.back().Move(5, 7);
+  for (auto expand_for_animation :
+       {kDontExpandVisualRectForAnimation, kExpandVisualRectForAnimation}) {
+    Vector<FloatClipRect> actual_visual_rects;
+    for (const auto& rect : input_rects)
+      actual_visual_rects.push_back(FloatClipRect(rect));
+    GeometryMapper::LocalToAncestorVisualRects(
+        local_state, ancestor_state, actual_visual_rects,
+        kIgnorePlatformOverlayScrollbarSize, expand_for_animation);
+    for (wtf_size_t i = 0; i < input_rects.size(); ++i) {
+      FloatClipRect expected(input_rects[i]);
+      GeometryMapper::LocalToAncestorVisualRect(
+          local_state, ancestor_state, expected,
+          kIgnorePlatformOverlayScrollbarSize, kNonInclusiveIntersect,
+          expand_for_animation);
+      EXPECT_CLIP_RECT_EQ(expected, actual_visual_rects[i]);
+    }
+  }
+}
+
 void GeometryMapperTest::CheckLocalToAncestorClipRect() {
   FloatClipRect actual_clip_rect =
       GeometryMapper::LocalToAncestorClipRect(local_state, ancestor_state);
@@ -150,6 +176,7 @@ void GeometryMapperTest::CheckCachedClip() {
 // this macro.
 void GeometryMapperTest::CheckMappings() {
   CheckLocalToAncestorVisualRect();
+  CheckLocalToAncestorVisualRects();
   CheckLocalToAncestorClipRect();
   CheckSourceToDestinationRect();
   CheckSourceToDestinationProjection();
@@ -942,4 +969,32 @@ TEST_P(GeometryMapperTest, Precision) {
       GeometryMapper::SourceToDestinationProjection(*t2, *t3).IsIdentity());
 }
 
+#if DCHECK_IS_ON()
+TEST_P(GeometryMapperTest, CacheStatistics) {
+  auto t1 = Create2DTranslation(t0(), 10, 20);
+  auto c1 = CreateClip(c0(), *t1, FloatRoundedRect(0, 0, 100, 100));
+  auto c2 = CreateClip(*c1, *t1, FloatRoundedRect(10, 10, 50, 50));
+  auto t2 = Create2DTranslation(*t1, 5, 5);
+  PropertyTreeState local(*t2, *c2, e0());
+
+  GeometryMapper::ClearCache();
+  GeometryMapper::ResetCacheStatisticsForTesting();
+  FloatClipRect rect(FloatRect(0, 0, 10, 10));
+  GeometryMapper::LocalToAncestorVisualRect(local, PropertyTreeState::Root(),
+                                            rect);
+  auto statistics = GeometryMapper::GetCacheStatisticsForTesting();
+  EXPECT_LT(0u, statistics.clip_cache_misses);
+  EXPECT_LT(0u, statistics.transform_cache_misses);
+
+  GeometryMapper::ResetCacheStatisticsForTesting();
+  rect = FloatClipRect(FloatRect(0, 0, 10, 10));
+  GeometryMapper::LocalToAncestorVisualRect(local, PropertyTreeState::Root(),
+                                            rect);
+  statistics = GeometryMapper::GetCacheStatisticsForTesting();
+  EXPECT_EQ(0u, statistics.transform_cache_misses);
+  EXPECT_EQ(0u, statistics.clip_cache_misses);
+  EXPECT_LT(0u, statistics.clip_cache_hits);
+}
+#endif
+
 }  // namespace blink
@@ -13,6 +13,11 @@ namespace blink {
 // with s_global_generation.
 unsigned GeometryMapperTransformCache::s_global_generation;
 
+#if DCHECK_IS_ON()
+GeometryMapperTransformCache::Statistics
+    GeometryMapperTransformCache::s_statistics;
+#endif
+
 void GeometryMapperTransformCache::ClearCache() {
   s_global_generation++;
 }
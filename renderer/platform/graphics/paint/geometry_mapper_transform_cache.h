@@ -25,11 +25,29 @@ class PLATFORM_EXPORT GeometryMapperTransformCache {
   bool IsValid() const;
 
   void UpdateIfNeeded(const TransformPaintPropertyNode& node) {
+#if DCHECK_IS_ON()
+    if (cache_generation_ == s_global_generation)
+      ++s_statistics.hits;
+    else
+      ++s_statistics.misses;
+#endif
     if (cache_generation_ != s_global_generation)
       Update(node);
     DCHECK_EQ(cache_generation_, s_global_generation);
   }
 
+#if DCHECK_IS_ON()
+  // Counts of UpdateIfNeeded() calls which found the cache valid (hits) or
+  // needed to update the cache (misses), for
+  // GeometryMapper::GetCacheStatisticsForTesting().
+  struct Statistics {
+    size_t hits = 0;
+    size_t misses = 0;
+  };
+  static const Statistics& GetStatistics() { return s_statistics; }
+  static void ResetStatistics() { s_statistics = Statistics(); }
+#endif
+
   const FloatSize& to_2d_translation_root() const {
     return to_2d_translation_root_;
   }
@@ -122,6 +140,9 @@ class PLATFORM_EXPORT GeometryMapperTransformCache {
   void Update(const TransformPaintPropertyNode&);
 
   static unsigned s_global_generation;
+#if DCHECK_IS_ON()
+  static Statistics s_statistics;
+#endif
 
   // The accumulated 2d translation to root_of_2d_translation().
   FloatSize to_2d_translation_root_;
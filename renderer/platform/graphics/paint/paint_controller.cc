@@ -321,6 +321,67 @@ void PaintController::ProcessNewItem(DisplayItem& display_item) {
   DidAppendItem(display_item);
 }
 
+void PaintController::DidRecordNewDrawing(const DisplayItem& display_item) {
+  DCHECK(display_item.IsDrawing());
+  if (!RuntimeEnabledFeatures::PaintRecordReuseEnabled() ||
+      usage_ == kTransient || cache_is_all_invalid_ ||
+      !display_item.IsCacheable() || !display_item.DrawsContent())
+    return;
+  // Under-invalidation checking may have replaced the new item with the cached
+  // one, so the last item is not necessarily |display_item|.
+  if (RuntimeEnabledFeatures::PaintUnderInvalidationCheckingEnabled())
+    return;
+  DCHECK_EQ(&new_display_item_list_.Last(), &display_item);
+  new_drawing_item_indices_.push_back(new_display_item_list_.size() - 1);
+}
+
+void PaintController::ReuseIdenticalPaintRecords() {
+  if (new_drawing_item_indices_.IsEmpty())
+    return;
+
+  TRACE_EVENT1("blink", "PaintController::ReuseIdenticalPaintRecords",
+               "num_candidates", new_drawing_item_indices_.size());
+  for (auto index : new_drawing_item_indices_) {
+    auto& new_item =
+        static_cast<DrawingDisplayItem&>(new_display_item_list_[index]);
+    auto old_index = FindOldItemForRecordReuse(new_item.GetId());
+    if (old_index == kNotFound)
+      continue;
+    const auto& old_item =
+        current_paint_artifact_->GetDisplayItemList()[old_index];
+    if (!old_item.IsDrawing())
+      continue;
+    new_item.ReuseRecordIfIdentical(
+        static_cast<const DrawingDisplayItem&>(old_item));
+  }
+  new_drawing_item_indices_.clear();
+}
+
+// Similar to FindCachedItem(), but is called after painting, when all cached
+// items have been moved out of the current list. The remaining items are
+// either invalidated or disappeared, so we don't need to check validity of the
+// client, and not finding the item is not unexpected.
+wtf_size_t PaintController::FindOldItemForRecordReuse(
+    const DisplayItem::Id& id) {
+  wtf_size_t found_index =
+      FindMatchingItemFromIndex(id, out_of_order_item_indices_,
+                                current_paint_artifact_->GetDisplayItemList());
+  if (found_index != kNotFound)
+    return found_index;
+
+  for (auto i = next_item_to_index_;
+       i < current_paint_artifact_->GetDisplayItemList().size(); ++i) {
+    const DisplayItem& item = current_paint_artifact_->GetDisplayItemList()[i];
+    next_item_to_index_ = i + 1;
+    if (item.IsTombstone() || !item.IsCacheable())
+      continue;
+    if (id == item.GetId())
+      return i;
+    AddToIndicesByClientMap(item.Client(), i, out_of_order_item_indices_);
+  }
+  return kNotFound;
+}
+
 DisplayItem& PaintController::MoveItemFromCurrentListToNewList(
     wtf_size_t index) {
   return new_display_item_list_.AppendByMoving(
@@ -559,6 +620,7 @@ void PaintController::CommitNewDisplayItems() {
 
   num_cached_new_items_ = 0;
   num_cached_new_subsequences_ = 0;
+  ReuseIdenticalPaintRecords();
 #if DCHECK_IS_ON()
   new_display_item_indices_by_client_.clear();
   new_paint_chunk_indices_by_client_.clear();
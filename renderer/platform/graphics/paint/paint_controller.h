@@ -128,6 +128,8 @@ class PLATFORM_EXPORT PaintController {
             std::forward<Args>(args)...);
     display_item.SetFragment(current_fragment_);
     ProcessNewItem(display_item);
+    if (display_item.IsDrawing())
+      DidRecordNewDrawing(display_item);
   }
 
   // Tries to find the cached display item corresponding to the given
@@ -277,6 +279,16 @@ class PLATFORM_EXPORT PaintController {
   void ProcessNewItem(DisplayItem&);
 
   void DidAppendItem(DisplayItem&);
+  // Remembers a newly recorded (i.e. not copied from cache) drawing display
+  // item for ReuseIdenticalPaintRecords().
+  void DidRecordNewDrawing(const DisplayItem&);
+  // For each newly recorded drawing display item, finds the old display item
+  // with the same id in the current list, and lets the new display item share
+  // the PaintRecord of the old one if they are identical. This lets
+  // DisplayItemRasterInvalidator skip raster invalidation for display items
+  // whose clients were invalidated without visual change.
+  void ReuseIdenticalPaintRecords();
+  wtf_size_t FindOldItemForRecordReuse(const DisplayItem::Id&);
   DisplayItem& MoveItemFromCurrentListToNewList(wtf_size_t);
   void DidAppendChunk();
 
@@ -356,6 +368,10 @@ class PLATFORM_EXPORT PaintController {
   wtf_size_t num_cached_new_items_ = 0;
   wtf_size_t num_cached_new_subsequences_ = 0;
 
+  // Indices in new_display_item_list_ of the newly recorded drawing display
+  // items which are candidates of ReuseIdenticalPaintRecords().
+  Vector<wtf_size_t> new_drawing_item_indices_;
+
   // Stores indices to valid cacheable display items in
   // current_paint_artifact_.GetDisplayItemList() that have not been matched by
   // requests of cached display items (using UseCachedItemIfPossible() and
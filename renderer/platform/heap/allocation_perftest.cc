@@ -0,0 +1,118 @@
+// Copyright 2020 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "base/callback.h"
+#include "base/check_op.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+#include "third_party/blink/renderer/platform/heap/heap.h"
+#include "third_party/blink/renderer/platform/heap/heap_stats_collector.h"
+#include "third_party/blink/renderer/platform/heap/heap_test_utilities.h"
+#include "third_party/blink/renderer/platform/heap/persistent.h"
+
+namespace blink {
+
+class AllocationPerfTest : public TestSupportingGC {};
+
+namespace {
+
+constexpr char kMetricPrefixAllocation[] = "Allocation.";
+constexpr char kMetricAllocationsRunsPerS[] = "allocations";
+constexpr char kMetricRefillsPerMillionAllocations[] =
+    "refills_per_million_allocations";
+
+perf_test::PerfResultReporter SetUpReporter(const std::string& story_name) {
+  perf_test::PerfResultReporter reporter(kMetricPrefixAllocation, story_name);
+  reporter.RegisterImportantMetric(kMetricAllocationsRunsPerS, "runs/s");
+  reporter.RegisterImportantMetric(kMetricRefillsPerMillionAllocations,
+                                   "count");
+  return reporter;
+}
+
+template <size_t Size>
+class PerfObject : public GarbageCollected<PerfObject<Size>> {
+ public:
+  PerfObject() = default;
+  void Trace(Visitor*) {}
+
+ private:
+  char payload_[Size];
+};
+
+base::TimeDelta TimedRun(base::RepeatingCallback<void()> callback) {
+  const base::TimeTicks start = base::TimeTicks::Now();
+  callback.Run();
+  return base::TimeTicks::Now() - start;
+}
+
+constexpr size_t kNumAllocations = 100000;
+
+// Allocates |kNumAllocations| objects of |Size| bytes and reports the
+// allocation rate as well as how often the linear allocation area of the
+// corresponding size class had to be refilled.
+template <size_t Size>
+void RunAllocationBenchmark(const std::string& story_name) {
+  // The size class statistics are reset by each garbage collection, so take
+  // the snapshot right after a forced one.
+  TestSupportingGC::PreciselyCollectGarbage();
+  ThreadState* thread_state = ThreadState::Current();
+  ThreadHeapStatsCollector* stats_collector =
+      thread_state->Heap().stats_collector();
+  const int arena_index =
+      ThreadHeap::ArenaIndexForObjectSize(sizeof(PerfObject<Size>));
+  const int64_t refills_before =
+      stats_collector->size_class_statistics(arena_index).refill_count;
+
+  Persistent<HeapVector<Member<PerfObject<Size>>>> holder(
+      MakeGarbageCollected<HeapVector<Member<PerfObject<Size>>>>());
+  holder->ReserveCapacity(kNumAllocations);
+  base::RepeatingCallback<void()> benchmark = base::BindRepeating(
+      [](const Persistent<HeapVector<Member<PerfObject<Size>>>>& holder) {
+        for (size_t i = 0; i < kNumAllocations; ++i)
+          holder->push_back(MakeGarbageCollected<PerfObject<Size>>());
+      },
+      holder);
+  const base::TimeDelta duration = TimedRun(benchmark);
+  const int64_t refills =
+      static_cast<int64_t>(
+          stats_collector->size_class_statistics(arena_index).refill_count) -
+      refills_before;
+  // A garbage collection during the benchmark would have reset the counter.
+  CHECK_GE(refills, 0);
+
+  // Cleanup.
+  holder.Clear();
+
+  // Reporting.
+  auto reporter = SetUpReporter(story_name);
+  reporter.AddResult(kMetricAllocationsRunsPerS,
+                     static_cast<double>(kNumAllocations) /
+                         duration.InSecondsF());
+  reporter.AddResult(kMetricRefillsPerMillionAllocations,
+                     static_cast<double>(refills) * 1000000 / kNumAllocations);
+}
+
+}  // namespace
+
+TEST_F(AllocationPerfTest, ObjectSize8) {
+  RunAllocationBenchmark<8>("object_size_8");
+  PreciselyCollectGarbage();
+}
+
+TEST_F(AllocationPerfTest, ObjectSize48) {
+  RunAllocationBenchmark<48>("object_size_48");
+  PreciselyCollectGarbage();
+}
+
+TEST_F(AllocationPerfTest, ObjectSize96) {
+  RunAllocationBenchmark<96>("object_size_96");
+  PreciselyCollectGarbage();
+}
+
+TEST_F(AllocationPerfTest, ObjectSize256) {
+  RunAllocationBenchmark<256>("object_size_256");
+  PreciselyCollectGarbage();
+}
+
+}  // namespace blink
@@ -19,6 +19,8 @@ const char* BlinkGC::ToString(BlinkGC::GCReason reason) {
       return "UnifiedHeapForMemoryReductionGC";
     case BlinkGC::GCReason::kUnifiedHeapForcedForTestingGC:
       return "UnifiedHeapForcedForTestingGC";
+    case BlinkGC::GCReason::kYoungGenerationGC:
+      return "YoungGenerationGC";
   }
   IMMEDIATE_CRASH();
 }
@@ -108,8 +108,9 @@ class PLATFORM_EXPORT BlinkGC final {
     kUnifiedHeapGC = 10,
     kUnifiedHeapForMemoryReductionGC = 11,
     kUnifiedHeapForcedForTestingGC = 12,
+    kYoungGenerationGC = 13,
     // Used by UMA_HISTOGRAM_ENUMERATION macro.
-    kMaxValue = kUnifiedHeapForcedForTestingGC,
+    kMaxValue = kYoungGenerationGC,
   };
 
 #define DeclareArenaIndex(name) k##name##ArenaIndex,
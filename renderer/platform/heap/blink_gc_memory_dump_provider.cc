@@ -11,6 +11,7 @@
 #include "base/trace_event/process_memory_dump.h"
 #include "third_party/blink/public/platform/platform.h"
 #include "third_party/blink/renderer/platform/heap/handle.h"
+#include "third_party/blink/renderer/platform/heap/heap_compact.h"
 #include "third_party/blink/renderer/platform/heap/thread_state.h"
 #include "third_party/blink/renderer/platform/heap/thread_state_statistics.h"
 #include "third_party/blink/renderer/platform/instrumentation/tracing/web_memory_allocator_dump.h"
@@ -79,6 +80,33 @@ bool BlinkGCMemoryDumpProvider::OnMemoryDump(
     return true;
   }
 
+  // Results of the last backing store compaction, which are not in the
+  // background allowlist. The difference between the free list sizes is the
+  // fragmentation reduction of the compactable arenas.
+  const HeapCompact::Statistics& compaction_stats =
+      thread_state_->Heap().Compaction()->LastStatistics();
+  auto* compaction_dump =
+      process_memory_dump->CreateAllocatorDump(dump_base_name_ + "/compaction");
+  compaction_dump->AddScalar(
+      "compaction_count", base::trace_event::MemoryAllocatorDump::kUnitsObjects,
+      compaction_stats.compaction_count);
+  compaction_dump->AddScalar(
+      "free_list_size_before",
+      base::trace_event::MemoryAllocatorDump::kUnitsBytes,
+      compaction_stats.free_list_size_before);
+  compaction_dump->AddScalar(
+      "free_list_size_after",
+      base::trace_event::MemoryAllocatorDump::kUnitsBytes,
+      compaction_stats.free_list_size_after);
+  compaction_dump->AddScalar(
+      "freed_size", base::trace_event::MemoryAllocatorDump::kUnitsBytes,
+      compaction_stats.freed_size);
+  compaction_dump->AddScalar(
+      "freed_pages", base::trace_event::MemoryAllocatorDump::kUnitsObjects,
+      compaction_stats.freed_pages);
+  compaction_dump->AddScalar("pause_time_us", "us",
+                             compaction_stats.pause_time.InMicroseconds());
+
   // Detailed statistics.
   for (const ThreadState::Statistics::ArenaStatistics& arena_stats :
        stats.arena_stats) {
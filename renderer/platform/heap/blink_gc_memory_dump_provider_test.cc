@@ -46,6 +46,39 @@ TEST_F(BlinkGCMemoryDumpProviderTest, MainThreadLightDump) {
 
   auto* main_heap = dump->GetAllocatorDump("blink_gc/main/heap");
   CheckBasicHeapDumpStructure(main_heap);
+  // Light dumps are also taken in the background, so they only contain
+  // allowlisted dumps.
+  EXPECT_EQ(nullptr, dump->GetAllocatorDump("blink_gc/main/heap/compaction"));
+}
+
+TEST_F(BlinkGCMemoryDumpProviderTest, MainThreadCompactionDump) {
+  ThreadState::Current()->EnableCompactionForNextGCForTesting();
+  PreciselyCollectGarbage();
+
+  base::trace_event::MemoryDumpArgs args = {
+      base::trace_event::MemoryDumpLevelOfDetail::DETAILED};
+  std::unique_ptr<base::trace_event::ProcessMemoryDump> dump(
+      new base::trace_event::ProcessMemoryDump(args));
+  std::unique_ptr<BlinkGCMemoryDumpProvider> dump_provider(
+      new BlinkGCMemoryDumpProvider(
+          ThreadState::Current(), base::ThreadTaskRunnerHandle::Get(),
+          BlinkGCMemoryDumpProvider::HeapType::kBlinkMainThread));
+  dump_provider->OnMemoryDump(args, dump.get());
+
+  auto* compaction = dump->GetAllocatorDump("blink_gc/main/heap/compaction");
+  ASSERT_NE(nullptr, compaction);
+  bool found_compaction_count = false;
+  bool found_pause_time = false;
+  for (const auto& entry : compaction->entries()) {
+    if (entry.name == "compaction_count") {
+      found_compaction_count = true;
+      EXPECT_LT(0u, entry.value_uint64);
+    }
+    if (entry.name == "pause_time_us")
+      found_pause_time = true;
+  }
+  EXPECT_TRUE(found_compaction_count);
+  EXPECT_TRUE(found_pause_time);
 }
 
 TEST_F(BlinkGCMemoryDumpProviderTest, MainThreadDetailedDump) {
@@ -540,9 +540,12 @@ void ThreadHeap::Compact() {
 
   // Compact the hash table backing store arena first, it usually has
   // higher fragmentation and is larger.
+  const base::TimeTicks start_time = base::TimeTicks::Now();
   for (int i = BlinkGC::kHashTableArenaIndex; i >= BlinkGC::kVectorArenaIndex;
        --i)
     static_cast<NormalPageArena*>(arenas_[i])->SweepAndCompact();
+  Compaction()->IncreaseArenaCompactionTime(base::TimeTicks::Now() -
+                                            start_time);
   Compaction()->Finish();
 }
 
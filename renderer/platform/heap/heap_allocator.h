@@ -56,6 +56,7 @@ class PLATFORM_EXPORT HeapAllocator {
   using LivenessBroker = blink::LivenessBroker;
   using Visitor = blink::Visitor;
   static constexpr bool kIsGarbageCollected = true;
+  static constexpr bool kCanExpandVectorBackingInPlace = true;
 
   template <typename T>
   static size_t MaxElementCountInBackingStore() {
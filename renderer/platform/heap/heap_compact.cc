@@ -4,16 +4,20 @@
 
 #include "third_party/blink/renderer/platform/heap/heap_compact.h"
 
+#include <algorithm>
+#include <atomic>
 #include <memory>
 
 #include "base/debug/alias.h"
 #include "base/memory/ptr_util.h"
+#include "base/task/post_job.h"
 #include "third_party/blink/public/common/features.h"
 #include "third_party/blink/renderer/platform/heap/heap.h"
 #include "third_party/blink/renderer/platform/heap/heap_stats_collector.h"
 #include "third_party/blink/renderer/platform/instrumentation/histogram.h"
 #include "third_party/blink/renderer/platform/runtime_enabled_features.h"
 #include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
+#include "third_party/blink/renderer/platform/wtf/cross_thread_functional.h"
 #include "third_party/blink/renderer/platform/wtf/hash_map.h"
 
 namespace blink {
@@ -40,6 +44,15 @@ class HeapCompact::MovableObjectFixups final {
   // Adds a slot for compaction. Filters slots in dead objects.
   void AddOrFilter(const MovableReference*);
 
+  // Moves the non-null slots from |slots| to |live_slots| if they should be
+  // recorded (see ShouldRecordSlot()), using multiple threads. Returns the
+  // number of non-null slots.
+  size_t FilterSlotsInParallel(MovableReferenceWorklist* slots,
+                               MovableReferenceWorklist* live_slots);
+
+  // Adds a slot that has passed ShouldRecordSlot() for compaction.
+  void Add(const MovableReference*);
+
   // Relocates a backing store |from| -> |to|.
   void Relocate(Address from, Address to);
 
@@ -60,6 +73,21 @@ class HeapCompact::MovableObjectFixups final {
 #endif
 
  private:
+  struct ParallelFilterState {
+    MovableReferenceWorklist* slots;
+    MovableReferenceWorklist* live_slots;
+    std::atomic<int> next_task_id{0};
+    std::atomic<size_t> non_null_slot_count{0};
+  };
+
+  // Returns true if |slot| is contained in a live object and points to a
+  // backing store that may be moved. Only reads heap metadata that does not
+  // change during the atomic pause, so it may be called concurrently.
+  bool ShouldRecordSlot(const MovableReference* slot) const;
+
+  // Job task of FilterSlotsInParallel().
+  void FilterSlotsConcurrently(ParallelFilterState*, base::JobDelegate*);
+
   void VerifyUpdatedSlot(MovableReference* slot);
 
   ThreadHeap* const heap_;
@@ -100,7 +128,13 @@ void HeapCompact::MovableObjectFixups::AddCompactingPage(BasePage* page) {
 }
 
 void HeapCompact::MovableObjectFixups::AddOrFilter(
-    const MovableReference* const_slot) {
+    const MovableReference* slot) {
+  if (ShouldRecordSlot(slot))
+    Add(slot);
+}
+
+bool HeapCompact::MovableObjectFixups::ShouldRecordSlot(
+    const MovableReference* const_slot) const {
   const void* value = *const_slot;
   CHECK(value);
 
@@ -122,7 +156,7 @@ void HeapCompact::MovableObjectFixups::AddOrFilter(
   CHECK(header);
   // Filter the slot since the object that contains the slot is dead.
   if (!header->IsMarked())
-    return;
+    return false;
 
   // Value handling.
   BasePage* const value_page =
@@ -134,7 +168,7 @@ void HeapCompact::MovableObjectFixups::AddOrFilter(
   // - Inline backings that are part of a non-backing arena.
   if (value_page->IsLargeObjectPage() ||
       !HeapCompact::IsCompactableArena(value_page->Arena()->ArenaIndex()))
-    return;
+    return false;
 
   // Slots must reside in and values must point to live objects at this
   // point, with the exception of slots in eagerly swept arenas where objects
@@ -146,6 +180,12 @@ void HeapCompact::MovableObjectFixups::AddOrFilter(
           ->FindHeaderFromAddress(reinterpret_cast<ConstAddress>(value));
   CHECK(value_header);
   CHECK(value_header->IsMarked());
+  return true;
+}
+
+void HeapCompact::MovableObjectFixups::Add(
+    const MovableReference* const_slot) {
+  const void* value = *const_slot;
 
   // Slots may have been recorded already but must point to the same
   // value. Example: Ephemeron iterations may register slots multiple
@@ -161,6 +201,8 @@ void HeapCompact::MovableObjectFixups::AddOrFilter(
   fixups_.insert(value, slot);
 
   // Check whether the slot itself resides on a page that is compacted.
+  BasePage* const slot_page =
+      heap_->LookupPageForAddress(reinterpret_cast<ConstAddress>(const_slot));
   if (LIKELY(!relocatable_pages_.Contains(slot_page)))
     return;
 
@@ -168,11 +210,70 @@ void HeapCompact::MovableObjectFixups::AddOrFilter(
   CHECK(interior_fixups_.end() == interior_it);
   interior_fixups_.emplace(slot, nullptr);
 #if DCHECK_IS_ON()
+  // Relocatable pages are always normal pages.
+  HeapObjectHeader* const header =
+      static_cast<NormalPage*>(slot_page)->FindHeaderFromAddress(
+          reinterpret_cast<ConstAddress>(const_slot));
   interior_slot_to_object_.insert(slot, header->Payload());
 #endif  // DCHECK_IS_ON()
   LOG_HEAP_COMPACTION() << "Interior slot: " << slot;
 }
 
+size_t HeapCompact::MovableObjectFixups::FilterSlotsInParallel(
+    MovableReferenceWorklist* slots,
+    MovableReferenceWorklist* live_slots) {
+  ParallelFilterState state;
+  state.slots = slots;
+  state.live_slots = live_slots;
+  base::JobHandle handle = base::PostJob(
+      FROM_HERE,
+      {base::TaskPriority::USER_BLOCKING,
+       base::TaskShutdownBehavior::SKIP_ON_SHUTDOWN},
+      ConvertToBaseRepeatingCallback(WTF::CrossThreadBindRepeating(
+          &MovableObjectFixups::FilterSlotsConcurrently,
+          WTF::CrossThreadUnretained(this),
+          WTF::CrossThreadUnretained(&state))),
+      ConvertToBaseRepeatingCallback(WTF::CrossThreadBindRepeating(
+          [](ParallelFilterState* state) -> size_t {
+            // Each task needs its own worklist task id.
+            if (state->next_task_id.load(std::memory_order_relaxed) >=
+                MovableReferenceWorklist::kNumTasks)
+              return 0;
+            return std::min<size_t>(state->slots->GlobalPoolSize(),
+                                    MovableReferenceWorklist::kNumTasks);
+          },
+          WTF::CrossThreadUnretained(&state))));
+  // The mutator thread contributes to the job until all slots are filtered.
+  handle.Join();
+  DCHECK(slots->IsGlobalEmpty());
+  return state.non_null_slot_count.load(std::memory_order_relaxed);
+}
+
+void HeapCompact::MovableObjectFixups::FilterSlotsConcurrently(
+    ParallelFilterState* state,
+    base::JobDelegate*) {
+  const int task_id =
+      state->next_task_id.fetch_add(1, std::memory_order_relaxed);
+  if (task_id >= MovableReferenceWorklist::kNumTasks)
+    return;
+
+  MovableReferenceWorklist::View slots(state->slots, task_id);
+  MovableReferenceWorklist::View live_slots(state->live_slots, task_id);
+  size_t non_null_slot_count = 0;
+  const MovableReference* slot;
+  while (slots.Pop(&slot)) {
+    CHECK(heap_->LookupPageForAddress(reinterpret_cast<ConstAddress>(slot)));
+    if (!*slot)
+      continue;
+    non_null_slot_count++;
+    if (ShouldRecordSlot(slot))
+      live_slots.Push(slot);
+  }
+  live_slots.FlushToGlobal();
+  state->non_null_slot_count.fetch_add(non_null_slot_count,
+                                       std::memory_order_relaxed);
+}
+
 void HeapCompact::MovableObjectFixups::Relocate(Address from, Address to) {
 #if DCHECK_IS_ON()
     moved_objects_.insert(from);
@@ -374,6 +475,9 @@ void HeapCompact::Initialize(ThreadState* state) {
   do_compact_ = true;
   gc_count_since_last_compaction_ = 0;
   force_for_next_gc_ = false;
+  current_statistics_ = Statistics();
+  current_statistics_.compaction_count = last_statistics_.compaction_count + 1;
+  current_statistics_.free_list_size_before = free_list_size_;
 }
 
 bool HeapCompact::ShouldRegisterMovingAddress() {
@@ -423,6 +527,12 @@ void HeapCompact::FinishedArenaCompaction(NormalPageArena* arena,
 
   heap_->stats_collector()->IncreaseCompactionFreedPages(freed_pages);
   heap_->stats_collector()->IncreaseCompactionFreedSize(freed_size);
+  current_statistics_.freed_pages += freed_pages;
+  current_statistics_.freed_size += freed_size;
+}
+
+void HeapCompact::IncreaseArenaCompactionTime(base::TimeDelta time) {
+  current_statistics_.pause_time += time;
 }
 
 void HeapCompact::Relocate(Address from, Address to) {
@@ -440,17 +550,33 @@ void HeapCompact::FilterNonLiveSlots() {
   if (!do_compact_)
     return;
 
+  const base::TimeTicks start_time = base::TimeTicks::Now();
   last_fixup_count_for_testing_ = 0;
-  MovableReferenceWorklist::View traced_slots(
-      heap_->GetMovableReferenceWorklist(), WorklistTaskId::MutatorThread);
-  const MovableReference* slot;
-  while (traced_slots.Pop(&slot)) {
-    CHECK(heap_->LookupPageForAddress(reinterpret_cast<ConstAddress>(slot)));
-    if (*slot) {
-      Fixups().AddOrFilter(slot);
-      last_fixup_count_for_testing_++;
+  if (base::FeatureList::IsEnabled(
+          blink::features::kBlinkHeapParallelCompaction)) {
+    // The liveness checks dominate the cost of filtering and are done in
+    // parallel. Recording the live slots in the fixup maps is sequential.
+    MovableReferenceWorklist live_slots;
+    last_fixup_count_for_testing_ = Fixups().FilterSlotsInParallel(
+        heap_->GetMovableReferenceWorklist(), &live_slots);
+    MovableReferenceWorklist::View live_slots_view(
+        &live_slots, WorklistTaskId::MutatorThread);
+    const MovableReference* slot;
+    while (live_slots_view.Pop(&slot))
+      Fixups().Add(slot);
+  } else {
+    MovableReferenceWorklist::View traced_slots(
+        heap_->GetMovableReferenceWorklist(), WorklistTaskId::MutatorThread);
+    const MovableReference* slot;
+    while (traced_slots.Pop(&slot)) {
+      CHECK(heap_->LookupPageForAddress(reinterpret_cast<ConstAddress>(slot)));
+      if (*slot) {
+        Fixups().AddOrFilter(slot);
+        last_fixup_count_for_testing_++;
+      }
     }
   }
+  current_statistics_.pause_time += base::TimeTicks::Now() - start_time;
 }
 
 void HeapCompact::Finish() {
@@ -461,6 +587,12 @@ void HeapCompact::Finish() {
   if (fixups_)
     fixups_->dumpDebugStats();
 #endif
+  for (int i = BlinkGC::kVectorArenaIndex; i <= BlinkGC::kHashTableArenaIndex;
+       ++i) {
+    current_statistics_.free_list_size_after +=
+        static_cast<NormalPageArena*>(heap_->Arena(i))->FreeListSize();
+  }
+  last_statistics_ = current_statistics_;
   do_compact_ = false;
   fixups_.reset();
 }
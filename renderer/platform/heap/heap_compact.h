@@ -8,6 +8,7 @@
 #include <memory>
 
 #include "base/memory/ptr_util.h"
+#include "base/time/time.h"
 #include "third_party/blink/renderer/platform/heap/blink_gc.h"
 #include "third_party/blink/renderer/platform/platform_export.h"
 #include "third_party/blink/renderer/platform/wtf/hash_map.h"
@@ -41,6 +42,20 @@ class PLATFORM_EXPORT HeapCompact final {
            arena_index <= BlinkGC::kHashTableArenaIndex;
   }
 
+  // Statistics of the last garbage collection that performed compaction.
+  struct Statistics {
+    // Number of garbage collections that performed compaction so far.
+    size_t compaction_count = 0;
+    // Free list size of the compactable arenas when compaction was scheduled
+    // and right after compaction.
+    size_t free_list_size_before = 0;
+    size_t free_list_size_after = 0;
+    size_t freed_pages = 0;
+    size_t freed_size = 0;
+    // Time spent in the atomic pause for slot filtering and compaction.
+    base::TimeDelta pause_time;
+  };
+
   explicit HeapCompact(ThreadHeap*);
   ~HeapCompact();
 
@@ -69,7 +84,8 @@ class PLATFORM_EXPORT HeapCompact final {
   // Slots that are not contained within live objects are filtered. This can
   // happen when the write barrier for in-payload objects triggers but the outer
   // backing store does not survive the marking phase because all its referents
-  // die before being reached by the marker.
+  // die before being reached by the marker. With BlinkHeapParallelCompaction,
+  // the liveness checks are performed on multiple threads.
   void FilterNonLiveSlots();
 
   // Finishes compaction and clears internal state.
@@ -78,6 +94,9 @@ class PLATFORM_EXPORT HeapCompact final {
   // Cancels compaction after slots may have been recorded already.
   void Cancel();
 
+  // Records the time spent in the atomic pause compacting the arenas.
+  void IncreaseArenaCompactionTime(base::TimeDelta);
+
   // Perform any relocation post-processing after having completed compacting
   // the given arena. The number of pages that were freed together with the
   // total size (in bytes) of freed heap storage, are passed in as arguments.
@@ -110,6 +129,8 @@ class PLATFORM_EXPORT HeapCompact final {
     return last_fixup_count_for_testing_;
   }
 
+  const Statistics& LastStatistics() const { return last_statistics_; }
+
  private:
   class MovableObjectFixups;
 
@@ -141,6 +162,10 @@ class PLATFORM_EXPORT HeapCompact final {
 
   size_t last_fixup_count_for_testing_ = 0;
 
+  // Statistics of the ongoing and the last finished compaction.
+  Statistics current_statistics_;
+  Statistics last_statistics_;
+
   bool force_for_next_gc_ = false;
 };
 
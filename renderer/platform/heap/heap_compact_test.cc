@@ -4,7 +4,9 @@
 
 #include "third_party/blink/renderer/platform/heap/heap_compact.h"
 
+#include "base/test/scoped_feature_list.h"
 #include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/public/common/features.h"
 #include "third_party/blink/renderer/platform/heap/handle.h"
 #include "third_party/blink/renderer/platform/heap/heap_test_utilities.h"
 #include "third_party/blink/renderer/platform/heap/persistent.h"
@@ -499,4 +501,53 @@ TEST_F(HeapCompactTest, CompactInlinedBackingStore) {
   PerformHeapCompaction();
 }
 
+TEST_F(HeapCompactTest, CompactHashMapWithParallelSlotFiltering) {
+  base::test::ScopedFeatureList scoped_feature_list;
+  scoped_feature_list.InitAndEnableFeature(
+      blink::features::kBlinkHeapParallelCompaction);
+  ClearOutOldGarbage();
+
+  Persistent<IntMap> int_map = MakeGarbageCollected<IntMap>();
+  Persistent<IntVector> vector = MakeGarbageCollected<IntVector>();
+  for (wtf_size_t i = 0; i < 1000; ++i) {
+    IntWrapper* val = IntWrapper::Create(i, HashTablesAreCompacted);
+    int_map->insert(val, 1000 - i);
+    vector->push_back(val);
+    // Garbage backing stores make the live ones move.
+    MakeGarbageCollected<IntVector>(10, val);
+  }
+
+  PerformHeapCompaction();
+  EXPECT_TRUE(IntWrapper::did_verify_at_least_once);
+  EXPECT_LT(0u, ThreadState::Current()
+                    ->Heap()
+                    .Compaction()
+                    ->LastFixupCountForTesting());
+
+  EXPECT_EQ(1000u, int_map->size());
+  for (auto k : *int_map)
+    EXPECT_EQ(k.key->Value(), 1000 - k.value);
+  for (wtf_size_t i = 0; i < vector->size(); ++i)
+    EXPECT_EQ(static_cast<int>(i), vector->at(i)->Value());
+}
+
+TEST_F(HeapCompactTest, CompactionStatistics) {
+  ClearOutOldGarbage();
+  const HeapCompact::Statistics& stats =
+      ThreadState::Current()->Heap().Compaction()->LastStatistics();
+  const size_t compaction_count = stats.compaction_count;
+
+  Persistent<IntVector> vector = MakeGarbageCollected<IntVector>();
+  for (wtf_size_t i = 0; i < 100; ++i) {
+    vector->push_back(IntWrapper::Create(i));
+    MakeGarbageCollected<IntVector>(100, vector->back());
+  }
+  PerformHeapCompaction();
+
+  EXPECT_EQ(compaction_count + 1, stats.compaction_count);
+  // The garbage vectors are reclaimed by compaction.
+  EXPECT_LT(0u, stats.freed_size);
+  EXPECT_FALSE(stats.pause_time.is_negative());
+}
+
 }  // namespace blink
@@ -424,6 +424,7 @@ NormalPageArena::NormalPageArena(ThreadState* state, int index)
     : BaseArena(state, index),
       current_allocation_point_(nullptr),
       remaining_allocation_size_(0),
+      allocation_area_size_(0),
       promptly_freed_size_(0) {}
 
 void NormalPageArena::AddToFreeList(Address address, size_t size) {
@@ -875,15 +876,28 @@ void NormalPageArena::SetAllocationPoint(Address point, size_t size) {
     DCHECK_LE(size, static_cast<NormalPage*>(page)->PayloadSize());
   }
 #endif
+  ThreadHeapStatsCollector* stats_collector =
+      GetThreadState()->Heap().stats_collector();
+  // Only the arenas selected by object size have size class statistics.
+  const bool is_size_class_arena =
+      ThreadHeapStatsCollector::IsSizeClassArena(ArenaIndex());
+  // Account the bytes that were allocated from the old linear allocation area.
+  // Promptly freeing an object right before the area may have grown the
+  // remaining size beyond the original area size.
+  if (is_size_class_arena &&
+      allocation_area_size_ > remaining_allocation_size_) {
+    stats_collector->IncreaseSizeClassAllocatedBytes(
+        ArenaIndex(), allocation_area_size_ - remaining_allocation_size_);
+  }
   // Free and clear the old linear allocation area.
   if (HasCurrentAllocationArea()) {
     AddToFreeList(CurrentAllocationPoint(), RemainingAllocationSize());
-    GetThreadState()->Heap().stats_collector()->DecreaseAllocatedObjectSize(
-        RemainingAllocationSize());
+    stats_collector->DecreaseAllocatedObjectSize(RemainingAllocationSize());
   }
   // Set up a new linear allocation area.
   current_allocation_point_ = point;
   remaining_allocation_size_ = size;
+  allocation_area_size_ = size;
   // Update last allocated region in ThreadHeap. This must also be done if the
   // allocation point is set to 0 (before doing GC), so that the last allocated
   // region is automatically reset after GC.
@@ -891,8 +905,9 @@ void NormalPageArena::SetAllocationPoint(Address point, size_t size) {
   if (point) {
     // Only, update allocated size and object start bitmap if the area is
     // actually set up with a non-null address.
-    GetThreadState()->Heap().stats_collector()->IncreaseAllocatedObjectSize(
-        size);
+    stats_collector->IncreaseAllocatedObjectSize(size);
+    if (is_size_class_arena)
+      stats_collector->IncreaseSizeClassRefillCount(ArenaIndex());
     // Current allocation point can never be part of the object bitmap start
     // because the area can grow or shrink. Will be added back before a GC when
     // clearing the allocation point.
@@ -1097,6 +1097,9 @@ class PLATFORM_EXPORT NormalPageArena final : public BaseArena {
   FreeList free_list_;
   Address current_allocation_point_;
   size_t remaining_allocation_size_;
+  // Size of the linear allocation area when it was set up. Used to account
+  // the allocated bytes per size class when the area is retired.
+  size_t allocation_area_size_;
 
   // The size of promptly freed objects in the heap. This counter is set to
   // zero before sweeping when clearing the free list and after coalescing.
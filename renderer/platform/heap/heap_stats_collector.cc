@@ -90,6 +90,27 @@ void ThreadHeapStatsCollector::DecreaseAllocatedSpace(size_t bytes) {
   });
 }
 
+static int SizeClassIndex(int arena_index) {
+  DCHECK(ThreadHeapStatsCollector::IsSizeClassArena(arena_index));
+  return arena_index - BlinkGC::kNormalPage1ArenaIndex;
+}
+
+void ThreadHeapStatsCollector::IncreaseSizeClassAllocatedBytes(
+    int arena_index,
+    size_t allocated_bytes) {
+  size_class_stats_since_prev_gc_[SizeClassIndex(arena_index)]
+      .allocated_bytes += allocated_bytes;
+}
+
+void ThreadHeapStatsCollector::IncreaseSizeClassRefillCount(int arena_index) {
+  size_class_stats_since_prev_gc_[SizeClassIndex(arena_index)].refill_count++;
+}
+
+const ThreadHeapStatsCollector::SizeClassStatistics&
+ThreadHeapStatsCollector::size_class_statistics(int arena_index) const {
+  return size_class_stats_since_prev_gc_[SizeClassIndex(arena_index)];
+}
+
 void ThreadHeapStatsCollector::NotifyMarkingStarted(
     BlinkGC::CollectionType collection_type,
     BlinkGC::GCReason reason) {
@@ -112,6 +133,10 @@ void ThreadHeapStatsCollector::NotifyMarkingCompleted(size_t marked_bytes) {
   allocated_bytes_since_prev_gc_ = 0;
   pos_delta_allocated_bytes_since_prev_gc_ = 0;
   neg_delta_allocated_bytes_since_prev_gc_ = 0;
+  for (int i = 0; i < kNumSizeClasses; i++) {
+    current_.size_class_stats[i] = size_class_stats_since_prev_gc_[i];
+    size_class_stats_since_prev_gc_[i] = SizeClassStatistics();
+  }
 
   ForAllObservers([marked_bytes](ThreadHeapStatsObserver* observer) {
     observer->ResetAllocatedObjectSize(marked_bytes);
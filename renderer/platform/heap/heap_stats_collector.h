@@ -204,6 +204,27 @@ class PLATFORM_EXPORT ThreadHeapStatsCollector {
     const base::TimeTicks start_time_;
   };
 
+  // Number of object size classes, i.e. normal page arenas. See
+  // ThreadHeap::ArenaIndexForObjectSize().
+  static constexpr int kNumSizeClasses =
+      BlinkGC::kNormalPage4ArenaIndex - BlinkGC::kNormalPage1ArenaIndex + 1;
+
+  // Whether |arena_index| is a normal page arena that objects are assigned to
+  // by size. The typed arenas, e.g. for vector backings, are not.
+  static constexpr bool IsSizeClassArena(int arena_index) {
+    return arena_index >= BlinkGC::kNormalPage1ArenaIndex &&
+           arena_index <= BlinkGC::kNormalPage4ArenaIndex;
+  }
+
+  // Allocation statistics of one size class.
+  struct SizeClassStatistics {
+    // Bytes that were bump allocated from linear allocation areas.
+    size_t allocated_bytes = 0;
+    // Number of times a linear allocation area was set up, i.e. the
+    // allocation slow path refilled from a free list entry or a new page.
+    size_t refill_count = 0;
+  };
+
   // POD to hold interesting data accumulated during a garbage collection cycle.
   // The event is always fully populated when looking at previous events but
   // is only be partially populated when looking at the current event. See
@@ -265,6 +286,9 @@ class PLATFORM_EXPORT ThreadHeapStatsCollector {
     size_t object_size_in_bytes_before_sweeping = 0;
     size_t allocated_space_in_bytes_before_sweeping = 0;
     size_t partition_alloc_bytes_before_sweeping = 0;
+    // Allocations per size class since the previous garbage collection, up to
+    // the end of marking.
+    SizeClassStatistics size_class_stats[kNumSizeClasses];
     double live_object_rate = 0;
     base::TimeDelta gc_nested_in_v8;
   };
@@ -301,6 +325,12 @@ class PLATFORM_EXPORT ThreadHeapStatsCollector {
   void DecreaseAllocatedObjectSize(size_t);
   void IncreaseAllocatedSpace(size_t);
   void DecreaseAllocatedSpace(size_t);
+  // Called when a linear allocation area of the normal page arena
+  // |arena_index| is retired with |allocated_bytes| used, and when a new
+  // linear allocation area is set up. |arena_index| must be a size class
+  // arena.
+  void IncreaseSizeClassAllocatedBytes(int arena_index, size_t allocated_bytes);
+  void IncreaseSizeClassRefillCount(int arena_index);
   void IncreaseWrapperCount(size_t);
   void DecreaseWrapperCount(size_t);
   void IncreaseCollectedWrapperCount(size_t);
@@ -328,6 +358,10 @@ class PLATFORM_EXPORT ThreadHeapStatsCollector {
 
   size_t allocated_space_bytes() const;
 
+  // Allocations of the size class of the normal page arena |arena_index|
+  // since the previous garbage collection.
+  const SizeClassStatistics& size_class_statistics(int arena_index) const;
+
   size_t wrapper_count() const;
   size_t collected_wrapper_count() const;
 
@@ -369,6 +403,10 @@ class PLATFORM_EXPORT ThreadHeapStatsCollector {
   // Allocated space in bytes for all arenas.
   size_t allocated_space_bytes_ = 0;
 
+  // Allocations per size class since the last garbage collection. These are
+  // moved into the current event after marking.
+  SizeClassStatistics size_class_stats_since_prev_gc_[kNumSizeClasses];
+
   bool is_started_ = false;
 
   // base::TimeDelta for RawScope. These don't need to be nested within a
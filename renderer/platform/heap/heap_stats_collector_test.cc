@@ -72,6 +72,30 @@ TEST(ThreadHeapStatsCollectorTest, StopResetsCurrent) {
                 .scope_data[ThreadHeapStatsCollector::kIncrementalMarkingStep]);
 }
 
+TEST(ThreadHeapStatsCollectorTest, SizeClassStatisticsMovedToCurrent) {
+  ThreadHeapStatsCollector stats_collector;
+  stats_collector.IncreaseSizeClassRefillCount(BlinkGC::kNormalPage2ArenaIndex);
+  stats_collector.IncreaseSizeClassAllocatedBytes(
+      BlinkGC::kNormalPage2ArenaIndex, 1024);
+  EXPECT_EQ(1024u, stats_collector
+                       .size_class_statistics(BlinkGC::kNormalPage2ArenaIndex)
+                       .allocated_bytes);
+  stats_collector.NotifyMarkingStarted(BlinkGC::CollectionType::kMajor,
+                                       BlinkGC::GCReason::kForcedGCForTesting);
+  stats_collector.NotifyMarkingCompleted(kNoMarkedBytes);
+  const int index =
+      BlinkGC::kNormalPage2ArenaIndex - BlinkGC::kNormalPage1ArenaIndex;
+  EXPECT_EQ(1024u,
+            stats_collector.current().size_class_stats[index].allocated_bytes);
+  EXPECT_EQ(1u, stats_collector.current().size_class_stats[index].refill_count);
+  EXPECT_EQ(0u, stats_collector
+                    .size_class_statistics(BlinkGC::kNormalPage2ArenaIndex)
+                    .allocated_bytes);
+  stats_collector.NotifySweepingCompleted();
+  EXPECT_EQ(1024u,
+            stats_collector.previous().size_class_stats[index].allocated_bytes);
+}
+
 TEST(ThreadHeapStatsCollectorTest, StartStop) {
   ThreadHeapStatsCollector stats_collector;
   EXPECT_FALSE(stats_collector.is_started());
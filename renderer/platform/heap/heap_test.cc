@@ -1604,6 +1604,34 @@ TEST_F(HeapTest, Transition) {
   EXPECT_TRUE(super_class == sub_class);
 }
 
+// Allocations from the typed arenas are not accounted to any size class.
+TEST_F(HeapTest, SizeClassStatisticsIgnoreTypedArenas) {
+  ClearOutOldGarbage();
+  ThreadHeapStatsCollector* stats_collector =
+      ThreadState::Current()->Heap().stats_collector();
+  size_t refill_counts[ThreadHeapStatsCollector::kNumSizeClasses];
+  for (int i = 0; i < ThreadHeapStatsCollector::kNumSizeClasses; i++) {
+    refill_counts[i] =
+        stats_collector
+            ->size_class_statistics(BlinkGC::kNormalPage1ArenaIndex + i)
+            .refill_count;
+  }
+  {
+    // Backings of a quarter page, below the large object threshold, make the
+    // vector arena refill its linear allocation area repeatedly.
+    HeapVector<Member<IntWrapper>> vectors[8];
+    for (auto& vector : vectors)
+      vector.ReserveCapacity(kBlinkPageSize / 4 / sizeof(Member<IntWrapper>));
+  }
+  for (int i = 0; i < ThreadHeapStatsCollector::kNumSizeClasses; i++) {
+    EXPECT_EQ(refill_counts[i],
+              stats_collector
+                  ->size_class_statistics(BlinkGC::kNormalPage1ArenaIndex + i)
+                  .refill_count);
+  }
+  PreciselyCollectGarbage();
+}
+
 TEST_F(HeapTest, Threading) {
   ThreadedHeapTester::Test();
 }
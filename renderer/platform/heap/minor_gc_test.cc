@@ -2,8 +2,11 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include "base/test/scoped_feature_list.h"
 #include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/public/common/features.h"
 #include "third_party/blink/renderer/platform/heap/heap_page.h"
+#include "third_party/blink/renderer/platform/heap/heap_stats_collector.h"
 #include "third_party/blink/renderer/platform/heap/heap_test_utilities.h"
 #include "third_party/blink/renderer/platform/heap/persistent.h"
 #include "third_party/blink/renderer/platform/heap/thread_state.h"
@@ -292,4 +295,28 @@ TYPED_TEST(MinorGCTestForType,
   EXPECT_EQ(1u, MinorGCTest::DestructedObjects());
 }
 
+TEST_F(MinorGCTest, ScheduleMinorGCAfterYoungGenerationLimit) {
+  base::test::ScopedFeatureList scoped_feature_list;
+  scoped_feature_list.InitAndEnableFeature(
+      blink::features::kBlinkHeapYoungGeneration);
+  ThreadState* state = ThreadState::Current();
+  ThreadHeapStatsCollector* stats_collector = state->Heap().stats_collector();
+
+  state->ScheduleGCIfNeeded();
+  EXPECT_EQ(ThreadState::kNoGCScheduled, state->GetGCState());
+
+  // Exceed the young generation allocation limit.
+  stats_collector->IncreaseAllocatedObjectSizeForTesting(8 * 1024 * 1024);
+  state->ScheduleGCIfNeeded();
+  EXPECT_EQ(ThreadState::kMinorGCScheduled, state->GetGCState());
+
+  state->SafePoint(BlinkGC::kNoHeapPointersOnStack);
+  EXPECT_EQ(ThreadState::kNoGCScheduled, state->GetGCState());
+  state->CompleteSweep();
+  EXPECT_EQ(BlinkGC::CollectionType::kMinor,
+            stats_collector->previous().collection_type);
+  EXPECT_EQ(BlinkGC::GCReason::kYoungGenerationGC,
+            stats_collector->previous().reason);
+}
+
 }  // namespace blink
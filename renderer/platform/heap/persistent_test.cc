@@ -5,11 +5,20 @@
 #include "third_party/blink/renderer/platform/heap/persistent.h"
 
 #include <memory>
+#include "base/atomic_ref_count.h"
+#include "base/synchronization/waitable_event.h"
+#include "base/time/time.h"
 #include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+#include "third_party/blink/public/platform/platform.h"
 #include "third_party/blink/renderer/platform/heap/handle.h"
 #include "third_party/blink/renderer/platform/heap/heap_test_utilities.h"
+#include "third_party/blink/renderer/platform/heap/process_heap.h"
+#include "third_party/blink/renderer/platform/scheduler/public/post_cross_thread_task.h"
+#include "third_party/blink/renderer/platform/scheduler/public/thread.h"
 #include "third_party/blink/renderer/platform/wtf/cross_thread_functional.h"
 #include "third_party/blink/renderer/platform/wtf/functional.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
 
 namespace blink {
 
@@ -53,5 +62,134 @@ TEST_F(PersistentTest, CrossThreadBindCancellation) {
   EXPECT_EQ(0, counter);
 }
 
+std::unique_ptr<Thread> CreateTestThread() {
+  return Platform::Current()->CreateThread(
+      ThreadCreationParams(ThreadType::kTestThread)
+          .SetThreadNameForTest("persistent test thread"));
+}
+
+using CrossThreadPersistentHandles =
+    Vector<std::unique_ptr<CrossThreadPersistent<Receiver>>>;
+
+void ReleaseHandles(std::unique_ptr<CrossThreadPersistentHandles> handles,
+                    base::WaitableEvent* done) {
+  handles.reset();
+  done->Signal();
+}
+
+int CrossThreadPersistentNodesInUse() {
+  MutexLocker lock(ProcessHeap::CrossThreadPersistentMutex());
+  return ProcessHeap::GetCrossThreadPersistentRegion().NodesInUse();
+}
+
+TEST_F(PersistentTest, CrossThreadPersistentReleasedOnOtherThread) {
+  constexpr size_t kNumHandles = 1000;
+  const int nodes_in_use = CrossThreadPersistentNodesInUse();
+  WeakPersistent<Receiver> receiver = MakeGarbageCollected<Receiver>();
+  auto handles = std::make_unique<CrossThreadPersistentHandles>();
+  for (size_t i = 0; i < kNumHandles; ++i) {
+    handles->push_back(
+        std::make_unique<CrossThreadPersistent<Receiver>>(receiver.Get()));
+  }
+  PreciselyCollectGarbage();
+  EXPECT_TRUE(receiver);
+  EXPECT_EQ(nodes_in_use + static_cast<int>(kNumHandles),
+            CrossThreadPersistentNodesInUse());
+
+  // Destroying the handles on another thread frees their nodes in the shared
+  // cross-thread region.
+  std::unique_ptr<Thread> thread = CreateTestThread();
+  base::WaitableEvent done;
+  PostCrossThreadTask(*thread->GetTaskRunner(), FROM_HERE,
+                      CrossThreadBindOnce(&ReleaseHandles, std::move(handles),
+                                          CrossThreadUnretained(&done)));
+  done.Wait();
+  EXPECT_EQ(nodes_in_use, CrossThreadPersistentNodesInUse());
+  PreciselyCollectGarbage();
+  EXPECT_FALSE(receiver);
+}
+
+constexpr int kContentionThreads = 4;
+constexpr size_t kContentionIterations = 20000;
+
+struct ContentionState {
+  CrossThreadPersistent<Receiver> receiver;
+  base::AtomicRefCount threads_to_finish{kContentionThreads};
+  base::WaitableEvent done;
+};
+
+void CreateAndDestroyHandles(ContentionState* state) {
+  for (size_t i = 0; i < kContentionIterations; ++i) {
+    CrossThreadPersistent<Receiver> handle(state->receiver.Get());
+    CrossThreadWeakPersistent<Receiver> weak_handle(handle.Get());
+  }
+  if (!state->threads_to_finish.Decrement())
+    state->done.Signal();
+}
+
+struct SharedHandleState {
+  CrossThreadPersistent<Receiver> receiver;
+  CrossThreadWeakPersistent<Receiver> shared;
+  base::AtomicRefCount threads_to_finish{kContentionThreads};
+  base::WaitableEvent done;
+};
+
+void AssignCopyAndClearSharedHandle(SharedHandleState* state) {
+  for (size_t i = 0; i < kContentionIterations; ++i) {
+    state->shared = state->receiver.Get();
+    CrossThreadWeakPersistent<Receiver> copy(state->shared);
+    state->shared.Clear();
+  }
+  if (!state->threads_to_finish.Decrement())
+    state->done.Signal();
+}
+
+// Copying, assigning and clearing the same CrossThreadWeakPersistent from
+// several threads is safe.
+TEST_F(PersistentTest, CrossThreadWeakPersistentSharedBetweenThreads) {
+  SharedHandleState state;
+  state.receiver = MakeGarbageCollected<Receiver>();
+  std::unique_ptr<Thread> threads[kContentionThreads];
+  for (auto& thread : threads)
+    thread = CreateTestThread();
+  for (auto& thread : threads) {
+    PostCrossThreadTask(*thread->GetTaskRunner(), FROM_HERE,
+                        CrossThreadBindOnce(&AssignCopyAndClearSharedHandle,
+                                            CrossThreadUnretained(&state)));
+  }
+  state.done.Wait();
+  EXPECT_FALSE(state.shared);
+  state.receiver.Clear();
+}
+
+// Creates and destroys cross-thread handles concurrently from several threads.
+// All of them contend on the process-wide cross-thread persistent mutex, so
+// this measures the cost of that lock.
+TEST_F(PersistentTest, CrossThreadPersistentContention) {
+  ContentionState state;
+  state.receiver = MakeGarbageCollected<Receiver>();
+  std::unique_ptr<Thread> threads[kContentionThreads];
+  for (auto& thread : threads)
+    thread = CreateTestThread();
+
+  const base::TimeTicks start = base::TimeTicks::Now();
+  for (auto& thread : threads) {
+    PostCrossThreadTask(*thread->GetTaskRunner(), FROM_HERE,
+                        CrossThreadBindOnce(&CreateAndDestroyHandles,
+                                            CrossThreadUnretained(&state)));
+  }
+  state.done.Wait();
+  const base::TimeDelta duration = base::TimeTicks::Now() - start;
+
+  perf_test::PerfResultReporter reporter("CrossThreadPersistent.",
+                                         "contention");
+  reporter.RegisterImportantMetric("handles", "runs/s");
+  reporter.AddResult("handles", 2.0 * kContentionThreads *
+                                    kContentionIterations /
+                                    duration.InSecondsF());
+  EXPECT_TRUE(state.receiver);
+  state.receiver.Clear();
+}
+
 }  // namespace
 }  // namespace blink
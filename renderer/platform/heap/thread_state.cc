@@ -476,6 +476,33 @@ void ThreadState::ScheduleGCIfNeeded() {
     StartIncrementalMarking(BlinkGC::GCReason::kForcedGCForTesting);
     return;
   }
+
+  if (GetGCState() == kNoGCScheduled && ShouldScheduleMinorGC()) {
+    VLOG(2) << "[state:" << this << "] "
+            << "ScheduleGCIfNeeded: Scheduled minor GC";
+    SetGCState(kMinorGCScheduled);
+    return;
+  }
+}
+
+bool ThreadState::ShouldScheduleMinorGC() const {
+#if BUILDFLAG(BLINK_HEAP_YOUNG_GENERATION)
+  if (!base::FeatureList::IsEnabled(
+          blink::features::kBlinkHeapYoungGeneration)) {
+    return false;
+  }
+  // Stand-alone garbage collections do not trace through V8 wrappers. Threads
+  // that are attached to an isolate are collected by unified heap garbage
+  // collections that are driven by V8.
+  if (isolate_)
+    return false;
+  // Sticky mark bits: everything allocated since the previous garbage
+  // collection is in the young generation.
+  return Heap().stats_collector()->allocated_bytes_since_prev_gc() >
+         kYoungGenerationAllocationLimit;
+#else
+  return false;
+#endif  // BLINK_HEAP_YOUNG_GENERATION
 }
 
 ThreadState* ThreadState::FromObject(const void* object) {
@@ -595,6 +622,7 @@ void UnexpectedGCState(ThreadState::GCState gc_state) {
     UNEXPECTED_GCSTATE(kIncrementalMarkingStepScheduled);
     UNEXPECTED_GCSTATE(kIncrementalMarkingFinalizeScheduled);
     UNEXPECTED_GCSTATE(kIncrementalGCScheduled);
+    UNEXPECTED_GCSTATE(kMinorGCScheduled);
   }
 }
 
@@ -616,7 +644,8 @@ void ThreadState::SetGCState(GCState gc_state) {
                               gc_state_ == kIncrementalMarkingStepScheduled ||
                               gc_state_ ==
                                   kIncrementalMarkingFinalizeScheduled ||
-                              gc_state_ == kIncrementalGCScheduled);
+                              gc_state_ == kIncrementalGCScheduled ||
+                              gc_state_ == kMinorGCScheduled);
       break;
     case kIncrementalMarkingStepScheduled:
       DCHECK(CheckThread());
@@ -638,7 +667,8 @@ void ThreadState::SetGCState(GCState gc_state) {
                               gc_state_ ==
                                   kIncrementalMarkingFinalizeScheduled ||
                               gc_state_ == kForcedGCForTestingScheduled ||
-                              gc_state_ == kIncrementalGCScheduled);
+                              gc_state_ == kIncrementalGCScheduled ||
+                              gc_state_ == kMinorGCScheduled);
       break;
     case kIncrementalGCScheduled:
       DCHECK(CheckThread());
@@ -652,6 +682,11 @@ void ThreadState::SetGCState(GCState gc_state) {
       DCHECK(!IsSweepingInProgress());
       VERIFY_STATE_TRANSITION(gc_state_ == kIncrementalMarkingStepScheduled);
       break;
+    case kMinorGCScheduled:
+      DCHECK(CheckThread());
+      DCHECK(!IsMarkingInProgress());
+      VERIFY_STATE_TRANSITION(gc_state_ == kNoGCScheduled);
+      break;
     default:
       NOTREACHED();
   }
@@ -694,6 +729,12 @@ void ThreadState::RunScheduledGC(BlinkGC::StackState stack_state) {
       CollectAllGarbageForTesting();
       forced_scheduled_gc_for_testing_ = false;
       break;
+    case kMinorGCScheduled:
+      CollectGarbage(BlinkGC::CollectionType::kMinor,
+                     BlinkGC::kNoHeapPointersOnStack, BlinkGC::kAtomicMarking,
+                     BlinkGC::kConcurrentAndLazySweeping,
+                     BlinkGC::GCReason::kYoungGenerationGC);
+      break;
     default:
       break;
   }
@@ -860,6 +901,15 @@ void UpdateTraceCounters(const ThreadHeapStatsCollector& stats_collector) {
   TRACE_COUNTER1(TRACE_DISABLED_BY_DEFAULT("blink_gc"),
                  "BlinkGC.PartitionAllocSizeAtLastGCKB",
                  CappedSizeInKB(event.partition_alloc_bytes_before_sweeping));
+  if (event.collection_type == BlinkGC::CollectionType::kMinor) {
+    TRACE_COUNTER1(TRACE_DISABLED_BY_DEFAULT("blink_gc"),
+                   "BlinkGC.AtomicPhaseAtLastMinorGCUs",
+                   event.atomic_pause_time().InMicroseconds());
+  } else {
+    TRACE_COUNTER1(TRACE_DISABLED_BY_DEFAULT("blink_gc"),
+                   "BlinkGC.AtomicPhaseAtLastMajorGCUs",
+                   event.atomic_pause_time().InMicroseconds());
+  }
 
   // Current values.
   TRACE_COUNTER1(TRACE_DISABLED_BY_DEFAULT("blink_gc"),
@@ -880,9 +930,35 @@ void UpdateTraceCounters(const ThreadHeapStatsCollector& stats_collector) {
 // Update histograms with statistics from the previous garbage collection cycle.
 // Anything that is part of a histogram should have a well-defined lifetime wrt.
 // to a garbage collection cycle.
+// Minor garbage collections only process the young generation and are
+// reported separately to not skew the histograms of major garbage collections.
+void UpdateMinorGCHistograms(const ThreadHeapStatsCollector::Event& event) {
+  UMA_HISTOGRAM_TIMES("BlinkGC.TimeForAtomicPhase.Minor",
+                      event.atomic_pause_time());
+  UMA_HISTOGRAM_TIMES("BlinkGC.TimeForGCCycle.Minor", event.gc_cycle_time());
+  UMA_HISTOGRAM_TIMES("BlinkGC.TimeForMarkingRoots.Minor",
+                      event.roots_marking_time());
+  UMA_HISTOGRAM_TIMES(
+      "BlinkGC.TimeForVisitingRememberedSets.Minor",
+      event.scope_data[ThreadHeapStatsCollector::kVisitRememberedSets]);
+  UMA_HISTOGRAM_TIMES("BlinkGC.TimeForSweepingSum.Minor",
+                      event.sweeping_time());
+
+  const int collection_rate_percent =
+      static_cast<int>(100 * (1.0 - event.live_object_rate));
+  DEFINE_STATIC_LOCAL(CustomCountHistogram, collection_rate_histogram,
+                      ("BlinkGC.CollectionRate.Minor", 1, 100, 20));
+  collection_rate_histogram.Count(collection_rate_percent);
+}
+
 void UpdateHistograms(const ThreadHeapStatsCollector::Event& event) {
   UMA_HISTOGRAM_ENUMERATION("BlinkGC.GCReason", event.reason);
 
+  if (event.collection_type == BlinkGC::CollectionType::kMinor) {
+    UpdateMinorGCHistograms(event);
+    return;
+  }
+
   UMA_HISTOGRAM_TIMES("BlinkGC.TimeForAtomicPhase", event.atomic_pause_time());
   UMA_HISTOGRAM_TIMES("BlinkGC.TimeForAtomicPhaseMarking",
                       event.atomic_marking_time());
@@ -968,6 +1044,7 @@ void UpdateHistograms(const ThreadHeapStatsCollector::Event& event) {
     COUNT_BY_GC_REASON(UnifiedHeapGC)
     COUNT_BY_GC_REASON(UnifiedHeapForMemoryReductionGC)
     COUNT_BY_GC_REASON(UnifiedHeapForcedForTestingGC)
+    COUNT_BY_GC_REASON(YoungGenerationGC)
 
 #undef COUNT_BY_GC_REASON
   }
@@ -1341,6 +1418,7 @@ void ThreadState::CollectGarbage(BlinkGC::CollectionType collection_type,
     COUNT_BY_GC_REASON(UnifiedHeapGC)
     COUNT_BY_GC_REASON(UnifiedHeapForMemoryReductionGC)
     COUNT_BY_GC_REASON(UnifiedHeapForcedForTestingGC)
+    COUNT_BY_GC_REASON(YoungGenerationGC)
   }
 #undef COUNT_BY_GC_REASON
 
@@ -1556,7 +1634,9 @@ void ThreadState::MarkPhasePrologue(BlinkGC::CollectionType collection_type,
                                     BlinkGC::GCReason reason) {
   SetGCPhase(GCPhase::kMarking);
 
+  // Compaction is only performed as part of major garbage collections.
   const bool compaction_enabled =
+      collection_type == BlinkGC::CollectionType::kMajor &&
       Heap().Compaction()->ShouldCompact(stack_state, marking_type, reason);
 
   Heap().SetupWorklists(compaction_enabled);
@@ -164,6 +164,7 @@ class PLATFORM_EXPORT ThreadState final {
     kIncrementalMarkingFinalizeScheduled,
     kForcedGCForTestingScheduled,
     kIncrementalGCScheduled,
+    kMinorGCScheduled,
   };
 
   // The phase that the GC is in. The GCPhase will not return kNone for mutators
@@ -408,6 +409,10 @@ class PLATFORM_EXPORT ThreadState final {
   static constexpr base::TimeDelta kDefaultIncrementalMarkingStepDuration =
       base::TimeDelta::FromMilliseconds(2);
 
+  // Bytes that may be allocated in the young generation before a minor garbage
+  // collection is scheduled.
+  static constexpr int64_t kYoungGenerationAllocationLimit = 4 * 1024 * 1024;
+
   // Stores whether some ThreadState is currently in incremental marking.
   static AtomicEntryFlag incremental_marking_flag_;
 
@@ -546,6 +551,10 @@ class PLATFORM_EXPORT ThreadState final {
   void ScheduleConcurrentMarking();
   void PerformConcurrentMark();
 
+  // Returns true if the young generation grew enough to warrant a minor
+  // garbage collection.
+  bool ShouldScheduleMinorGC() const;
+
   // Schedule helpers.
   void ScheduleIdleLazySweep();
   void ScheduleConcurrentAndLazySweep();
@@ -119,6 +119,36 @@ TEST_F(WeaknessMarkingTest, WeakSet) {
   TestSetImpl<Set, WeakPersistent>(ObjectLiveness::Dead);
 }
 
+template <typename T>
+struct GroupProbingHashTraits : HashTraits<T> {
+  using ProbingPolicy = GroupProbing<>;
+};
+
+TEST_F(WeaknessMarkingTest, WeakSetWithGroupProbing) {
+  using Set = HeapHashSet<WeakMember<IntegerObject>,
+                          WTF::DefaultHash<WeakMember<IntegerObject>>::Hash,
+                          GroupProbingHashTraits<WeakMember<IntegerObject>>>;
+  TestSetImpl<Set, Persistent>(ObjectLiveness::Alive);
+  TestSetImpl<Set, WeakPersistent>(ObjectLiveness::Dead);
+
+  // Weak processing leaves deleted buckets behind. Lookups for the surviving
+  // entries must probe past them.
+  constexpr int kNumObjects = 100;
+  Persistent<Set> set = MakeGarbageCollected<Set>();
+  Persistent<HeapVector<Member<IntegerObject>>> alive =
+      MakeGarbageCollected<HeapVector<Member<IntegerObject>>>();
+  for (int i = 0; i < kNumObjects; ++i) {
+    auto* object = MakeGarbageCollected<IntegerObject>(i);
+    set->insert(object);
+    if (i % 2)
+      alive->push_back(object);
+  }
+  PreciselyCollectGarbage();
+  EXPECT_EQ(alive->size(), set->size());
+  for (IntegerObject* object : *alive)
+    EXPECT_TRUE(set->Contains(object));
+}
+
 TEST_F(WeaknessMarkingTest, StrongSet) {
   using Set = HeapHashSet<Member<IntegerObject>>;
   TestSetImpl<Set, Persistent>(ObjectLiveness::Alive);
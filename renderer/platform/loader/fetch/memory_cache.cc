@@ -85,7 +85,8 @@ MemoryCache::MemoryCache(
       capacity_(kCDefaultCacheCapacity),
       delay_before_live_decoded_prune_(kCMinDelayBeforeLiveDecodedPrune),
       size_(0),
-      task_runner_(std::move(task_runner)) {
+      task_runner_(std::move(task_runner)),
+      eviction_policy_(MemoryCacheEvictionPolicy::Create()) {
   MemoryCacheDumpProvider::Instance()->SetMemoryCache(this);
   if (MemoryPressureListenerRegistry::IsLowEndDevice())
     MemoryPressureListenerRegistry::Instance().RegisterClient(this);
@@ -153,6 +154,7 @@ void MemoryCache::AddInternal(ResourceMap* resource_map,
     Update(old_resource, old_resource->size(), 0);
   }
   resource_map->Set(url, entry);
+  eviction_policy_->DidAccess(*entry);
   Update(resource, 0, resource->size());
 }
 
@@ -194,14 +196,31 @@ void MemoryCache::RemoveInternal(ResourceMap* resource_map,
 }
 
 bool MemoryCache::Contains(const Resource* resource) const {
+  return EntryForResource(resource);
+}
+
+MemoryCacheEntry* MemoryCache::EntryForResource(
+    const Resource* resource) const {
   if (!resource || resource->Url().IsEmpty())
-    return false;
+    return nullptr;
   const ResourceMap* resources = resource_maps_.at(resource->CacheIdentifier());
   if (!resources)
-    return false;
+    return nullptr;
   KURL url = RemoveFragmentIdentifierIfNeeded(resource->Url());
   MemoryCacheEntry* entry = resources->at(url);
-  return entry && resource == entry->GetResource();
+  if (!entry || resource != entry->GetResource())
+    return nullptr;
+  return entry;
+}
+
+void MemoryCache::DidLookUp(ResourceType type, Resource* reused_resource) {
+  LookupCount& count = lookup_counts_[static_cast<size_t>(type)];
+  ++count.lookups;
+  if (!reused_resource)
+    return;
+  ++count.hits;
+  if (MemoryCacheEntry* entry = EntryForResource(reused_resource))
+    eviction_policy_->DidAccess(*entry);
 }
 
 Resource* MemoryCache::ResourceForURL(const KURL& resource_url) const {
@@ -245,26 +264,37 @@ void MemoryCache::PruneResources(PruneStrategy strategy) {
   if (size_ <= size_limit)
     return;
 
+  // Check to see if the resources are too new to prune.
+  if (strategy == kAutomaticPrune &&
+      prune_frame_time_stamp_.since_origin() <
+          delay_before_live_decoded_prune_) {
+    return;
+  }
+
   // Cut by a percentage to avoid immediately pruning again.
   size_t target_size =
       static_cast<size_t>(size_limit * kCTargetPrunePercentage);
 
+  HeapVector<Member<MemoryCacheEntry>> entries;
   for (const auto& resource_map_iter : resource_maps_) {
     for (const auto& resource_iter : *resource_map_iter.value) {
       Resource* resource = resource_iter.value->GetResource();
       DCHECK(resource);
-      if (resource->IsLoaded() && resource->DecodedSize()) {
-        // Check to see if the remaining resources are too new to prune.
-        if (strategy == kAutomaticPrune &&
-            prune_frame_time_stamp_.since_origin() <
-                delay_before_live_decoded_prune_)
-          continue;
-        resource->Prune();
-        if (size_ <= target_size)
-          return;
-      }
+      if (resource->IsLoaded() && resource->DecodedSize())
+        entries.push_back(resource_iter.value);
     }
   }
+  eviction_policy_->SortForPruning(entries);
+
+  for (MemoryCacheEntry* entry : entries) {
+    Resource* resource = entry->GetResource();
+    if (!resource)
+      continue;
+    eviction_policy_->WillPrune(*entry);
+    resource->Prune();
+    if (size_ <= target_size)
+      return;
+  }
 }
 
 void MemoryCache::SetCapacity(size_t total_bytes) {
@@ -297,34 +327,40 @@ void MemoryCache::TypeStatistic::AddResource(Resource* o) {
       o->Url().ProtocolIsData() ? o->EncodedSize() : 0;
 }
 
+static MemoryCache::TypeStatistic& TypeStatisticFor(
+    MemoryCache::Statistics& stats,
+    ResourceType type) {
+  switch (type) {
+    case ResourceType::kImage:
+      return stats.images;
+    case ResourceType::kCSSStyleSheet:
+      return stats.css_style_sheets;
+    case ResourceType::kScript:
+      return stats.scripts;
+    case ResourceType::kXSLStyleSheet:
+      return stats.xsl_style_sheets;
+    case ResourceType::kFont:
+      return stats.fonts;
+    default:
+      return stats.other;
+  }
+}
+
 MemoryCache::Statistics MemoryCache::GetStatistics() const {
   Statistics stats;
   for (const auto& resource_map_iter : resource_maps_) {
     for (const auto& resource_iter : *resource_map_iter.value) {
       Resource* resource = resource_iter.value->GetResource();
       DCHECK(resource);
-      switch (resource->GetType()) {
-        case ResourceType::kImage:
-          stats.images.AddResource(resource);
-          break;
-        case ResourceType::kCSSStyleSheet:
-          stats.css_style_sheets.AddResource(resource);
-          break;
-        case ResourceType::kScript:
-          stats.scripts.AddResource(resource);
-          break;
-        case ResourceType::kXSLStyleSheet:
-          stats.xsl_style_sheets.AddResource(resource);
-          break;
-        case ResourceType::kFont:
-          stats.fonts.AddResource(resource);
-          break;
-        default:
-          stats.other.AddResource(resource);
-          break;
-      }
+      TypeStatisticFor(stats, resource->GetType()).AddResource(resource);
     }
   }
+  for (size_t i = 0; i < lookup_counts_.size(); ++i) {
+    TypeStatistic& type_stats =
+        TypeStatisticFor(stats, static_cast<ResourceType>(i));
+    type_stats.lookups += lookup_counts_[i].lookups;
+    type_stats.hits += lookup_counts_[i].hits;
+  }
   return stats;
 }
 
@@ -438,6 +474,23 @@ bool MemoryCache::OnMemoryDump(WebMemoryDumpLevelOfDetail level_of_detail,
     return true;
   }
 
+  // The hit rates are not reported in background dumps, which only allow the
+  // sizes.
+  Statistics stats = GetStatistics();
+  const std::pair<const char*, const TypeStatistic&> hit_rates[] = {
+      {"web_cache/Image_resources", stats.images},
+      {"web_cache/CSS stylesheet_resources", stats.css_style_sheets},
+      {"web_cache/Script_resources", stats.scripts},
+      {"web_cache/XSL stylesheet_resources", stats.xsl_style_sheets},
+      {"web_cache/Font_resources", stats.fonts},
+      {"web_cache/Other_resources", stats.other}};
+  for (const auto& hit_rate : hit_rates) {
+    WebMemoryAllocatorDump* dump =
+        memory_dump->CreateMemoryAllocatorDump(hit_rate.first);
+    dump->AddScalar("lookups", "objects", hit_rate.second.lookups);
+    dump->AddScalar("hits", "objects", hit_rate.second.hits);
+  }
+
   for (const auto& resource_map_iter : resource_maps_) {
     for (const auto& resource_iter : *resource_map_iter.value) {
       Resource* resource = resource_iter.value->GetResource();
@@ -26,9 +26,13 @@
 #ifndef THIRD_PARTY_BLINK_RENDERER_PLATFORM_LOADER_FETCH_MEMORY_CACHE_H_
 #define THIRD_PARTY_BLINK_RENDERER_PLATFORM_LOADER_FETCH_MEMORY_CACHE_H_
 
+#include <array>
+#include <memory>
+
 #include "base/macros.h"
 #include "third_party/blink/renderer/platform/instrumentation/memory_pressure_listener.h"
 #include "third_party/blink/renderer/platform/instrumentation/tracing/memory_cache_dump_provider.h"
+#include "third_party/blink/renderer/platform/loader/fetch/memory_cache_eviction_policy.h"
 #include "third_party/blink/renderer/platform/loader/fetch/resource.h"
 #include "third_party/blink/renderer/platform/platform_export.h"
 #include "third_party/blink/renderer/platform/scheduler/public/thread.h"
@@ -54,11 +58,22 @@ class MemoryCacheEntry final : public GarbageCollected<MemoryCacheEntry> {
   void Trace(Visitor*);
   Resource* GetResource() const { return resource_; }
 
+  // The state of the entry for MemoryCacheEvictionPolicy.
+  void DidAccess(double inflation) {
+    ++access_count_;
+    inflation_ = inflation;
+  }
+  uint32_t AccessCount() const { return access_count_; }
+  double Inflation() const { return inflation_; }
+
  private:
   void ClearResourceWeak(const LivenessBroker&);
 
   // We use UntracedMember<> here to do custom weak processing.
   UntracedMember<Resource> resource_;
+
+  uint32_t access_count_ = 0;
+  double inflation_ = 0;
 };
 
 // This cache holds subresources used by Web pages: images, scripts,
@@ -85,6 +100,10 @@ class PLATFORM_EXPORT MemoryCache final : public GarbageCollected<MemoryCache>,
     size_t overhead_size;
     size_t code_cache_size;
     size_t encoded_size_duplicated_in_data_urls;
+    // How many times resources were looked up, and how many of these times a
+    // resource was reused, since the cache was created.
+    size_t lookups;
+    size_t hits;
 
     TypeStatistic()
         : count(0),
@@ -93,7 +112,9 @@ class PLATFORM_EXPORT MemoryCache final : public GarbageCollected<MemoryCache>,
           encoded_size(0),
           overhead_size(0),
           code_cache_size(0),
-          encoded_size_duplicated_in_data_urls(0) {}
+          encoded_size_duplicated_in_data_urls(0),
+          lookups(0),
+          hits(0) {}
 
     void AddResource(Resource*);
   };
@@ -118,6 +139,11 @@ class PLATFORM_EXPORT MemoryCache final : public GarbageCollected<MemoryCache>,
   void Remove(Resource*);
   bool Contains(const Resource*) const;
 
+  // Called when a resource of type |type| has been looked up for a request.
+  // |reused_resource| is the resource of the cache that the request uses, or
+  // null if the request needs a new one.
+  void DidLookUp(ResourceType type, Resource* reused_resource);
+
   static KURL RemoveFragmentIdentifierIfNeeded(const KURL& original_url);
 
   static String DefaultCacheIdentifier();
@@ -155,6 +181,11 @@ class PLATFORM_EXPORT MemoryCache final : public GarbageCollected<MemoryCache>,
 
   void OnMemoryPressure(WebMemoryPressureLevel) override;
 
+  void SetEvictionPolicyForTesting(
+      std::unique_ptr<MemoryCacheEvictionPolicy> eviction_policy) {
+    eviction_policy_ = std::move(eviction_policy);
+  }
+
  private:
   enum PruneStrategy {
     // Automatically decide how much to prune.
@@ -174,6 +205,7 @@ class PLATFORM_EXPORT MemoryCache final : public GarbageCollected<MemoryCache>,
 
   void AddInternal(ResourceMap*, MemoryCacheEntry*);
   void RemoveInternal(ResourceMap*, const ResourceMap::iterator&);
+  MemoryCacheEntry* EntryForResource(const Resource*) const;
 
   void PruneResources(PruneStrategy);
   void PruneNow(PruneStrategy);
@@ -194,6 +226,15 @@ class PLATFORM_EXPORT MemoryCache final : public GarbageCollected<MemoryCache>,
 
   scoped_refptr<base::SingleThreadTaskRunner> task_runner_;
 
+  std::unique_ptr<MemoryCacheEvictionPolicy> eviction_policy_;
+
+  struct LookupCount {
+    size_t lookups = 0;
+    size_t hits = 0;
+  };
+  std::array<LookupCount, static_cast<size_t>(ResourceType::kMaxValue) + 1>
+      lookup_counts_;
+
   friend class MemoryCacheTest;
 
   DISALLOW_COPY_AND_ASSIGN(MemoryCache);
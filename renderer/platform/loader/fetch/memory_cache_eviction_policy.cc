@@ -0,0 +1,77 @@
+// Copyright 2020 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/platform/loader/fetch/memory_cache_eviction_policy.h"
+
+#include <algorithm>
+
+#include "base/feature_list.h"
+#include "third_party/blink/public/common/features.h"
+#include "third_party/blink/renderer/platform/loader/fetch/memory_cache.h"
+#include "third_party/blink/renderer/platform/loader/fetch/resource.h"
+
+namespace blink {
+
+namespace {
+
+// The cost of decoding a resource again regardless of its size, in decoded
+// bytes of a resource that costs 1 per byte.
+constexpr double kFixedDecodeCost = 4096;
+
+// Rough relative costs of rebuilding a byte of decoded data.
+double DecodeCostPerByte(ResourceType type) {
+  switch (type) {
+    case ResourceType::kCSSStyleSheet:
+    case ResourceType::kXSLStyleSheet:
+      // The parsed style sheet.
+      return 4;
+    case ResourceType::kFont:
+    case ResourceType::kSVGDocument:
+      return 2;
+    default:
+      return 1;
+  }
+}
+
+}  // namespace
+
+// static
+std::unique_ptr<MemoryCacheEvictionPolicy> MemoryCacheEvictionPolicy::Create() {
+  if (base::FeatureList::IsEnabled(features::kCostAwareMemoryCacheEviction))
+    return std::make_unique<CostAwareEvictionPolicy>();
+  return std::make_unique<MapOrderEvictionPolicy>();
+}
+
+void MapOrderEvictionPolicy::DidAccess(MemoryCacheEntry& entry) {
+  entry.DidAccess(0);
+}
+
+void CostAwareEvictionPolicy::DidAccess(MemoryCacheEntry& entry) {
+  entry.DidAccess(inflation_);
+}
+
+void CostAwareEvictionPolicy::SortForPruning(
+    HeapVector<Member<MemoryCacheEntry>>& entries) {
+  std::stable_sort(entries.begin(), entries.end(),
+                   [this](const Member<MemoryCacheEntry>& a,
+                          const Member<MemoryCacheEntry>& b) {
+                     return Priority(*a) < Priority(*b);
+                   });
+}
+
+void CostAwareEvictionPolicy::WillPrune(const MemoryCacheEntry& entry) {
+  inflation_ = std::max(inflation_, Priority(entry));
+}
+
+double CostAwareEvictionPolicy::Priority(const MemoryCacheEntry& entry) const {
+  const Resource* resource = entry.GetResource();
+  if (!resource)
+    return entry.Inflation();
+  double size = std::max<size_t>(resource->DecodedSize(), 1);
+  double cost =
+      kFixedDecodeCost + DecodeCostPerByte(resource->GetType()) * size;
+  return entry.Inflation() + entry.AccessCount() * cost / size;
+}
+
+}  // namespace blink
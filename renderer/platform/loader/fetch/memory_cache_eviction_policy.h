@@ -0,0 +1,85 @@
+// Copyright 2020 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef THIRD_PARTY_BLINK_RENDERER_PLATFORM_LOADER_FETCH_MEMORY_CACHE_EVICTION_POLICY_H_
+#define THIRD_PARTY_BLINK_RENDERER_PLATFORM_LOADER_FETCH_MEMORY_CACHE_EVICTION_POLICY_H_
+
+#include <memory>
+
+#include "base/macros.h"
+#include "third_party/blink/renderer/platform/heap/heap_allocator.h"
+#include "third_party/blink/renderer/platform/heap/member.h"
+#include "third_party/blink/renderer/platform/platform_export.h"
+#include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
+
+namespace blink {
+
+class MemoryCacheEntry;
+
+// Decides which resources MemoryCache prunes the decoded data of first when
+// it is over capacity.
+class PLATFORM_EXPORT MemoryCacheEvictionPolicy {
+  USING_FAST_MALLOC(MemoryCacheEvictionPolicy);
+
+ public:
+  // Returns the policy selected by the CostAwareMemoryCacheEviction feature.
+  static std::unique_ptr<MemoryCacheEvictionPolicy> Create();
+
+  MemoryCacheEvictionPolicy() = default;
+  virtual ~MemoryCacheEvictionPolicy() = default;
+
+  // Called when the resource of |entry| is added to the cache and each time it
+  // is reused from the cache.
+  virtual void DidAccess(MemoryCacheEntry& entry) = 0;
+
+  // Sorts |entries|, whose resources all have decoded data, in the order in
+  // which their decoded data should be pruned.
+  virtual void SortForPruning(
+      HeapVector<Member<MemoryCacheEntry>>& entries) = 0;
+
+  // Called right before the decoded data of the resource of |entry| is pruned.
+  virtual void WillPrune(const MemoryCacheEntry& entry) = 0;
+
+ private:
+  DISALLOW_COPY_AND_ASSIGN(MemoryCacheEvictionPolicy);
+};
+
+// Prunes in the iteration order of the resource maps of MemoryCache, which
+// has nothing to do with how the resources are used.
+class PLATFORM_EXPORT MapOrderEvictionPolicy final
+    : public MemoryCacheEvictionPolicy {
+ public:
+  MapOrderEvictionPolicy() = default;
+
+  void DidAccess(MemoryCacheEntry&) override;
+  void SortForPruning(HeapVector<Member<MemoryCacheEntry>>&) override {}
+  void WillPrune(const MemoryCacheEntry&) override {}
+};
+
+// A Greedy-Dual-Size-Frequency policy. The priority of an entry is
+//   inflation + access count * decode cost / decoded size
+// and the entries with the lowest priority are pruned first. The decode cost
+// estimates the time to rebuild the decoded data from the encoded data, which
+// MemoryCache keeps, so that small resources, resources of types that are
+// expensive to decode and frequently reused resources stay decoded longer.
+// The inflation is the priority of the last pruned entry when the entry was
+// last accessed, which ages the entries that are not accessed anymore.
+class PLATFORM_EXPORT CostAwareEvictionPolicy final
+    : public MemoryCacheEvictionPolicy {
+ public:
+  CostAwareEvictionPolicy() = default;
+
+  void DidAccess(MemoryCacheEntry&) override;
+  void SortForPruning(HeapVector<Member<MemoryCacheEntry>>&) override;
+  void WillPrune(const MemoryCacheEntry&) override;
+
+  double Priority(const MemoryCacheEntry&) const;
+
+ private:
+  double inflation_ = 0;
+};
+
+}  // namespace blink
+
+#endif  // THIRD_PARTY_BLINK_RENDERER_PLATFORM_LOADER_FETCH_MEMORY_CACHE_EVICTION_POLICY_H_
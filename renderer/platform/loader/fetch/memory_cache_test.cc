@@ -30,9 +30,13 @@
 
 #include "third_party/blink/renderer/platform/loader/fetch/memory_cache.h"
 
+#include <memory>
+#include <string>
+
 #include "testing/gtest/include/gtest/gtest.h"
 #include "third_party/blink/public/platform/platform.h"
 #include "third_party/blink/renderer/platform/heap/heap.h"
+#include "third_party/blink/renderer/platform/loader/fetch/memory_cache_eviction_policy.h"
 #include "third_party/blink/renderer/platform/loader/fetch/raw_resource.h"
 #include "third_party/blink/renderer/platform/loader/fetch/resource_fetcher.h"
 #include "third_party/blink/renderer/platform/loader/fetch/resource_loader_options.h"
@@ -419,4 +423,64 @@ TEST_F(MemoryCacheTest, RemoveURLFromCache) {
   EXPECT_FALSE(GetMemoryCache()->Contains(resource2));
 }
 
+static FakeDecodedResource* CreateDecodedResource(const char* url,
+                                                  size_t size) {
+  auto* resource = MakeGarbageCollected<FakeDecodedResource>(
+      ResourceRequest(url), ResourceLoaderOptions());
+  std::string data(size, 'a');
+  resource->AppendData(data.data(), data.size());
+  resource->FinishForTest();
+  return resource;
+}
+
+TEST_F(MemoryCacheTest, CostAwareEvictionPrunesLessReusedFirst) {
+  GetMemoryCache()->SetEvictionPolicyForTesting(
+      std::make_unique<CostAwareEvictionPolicy>());
+  GetMemoryCache()->SetDelayBeforeLiveDecodedPrune(base::TimeDelta());
+  Persistent<FakeDecodedResource> reused =
+      CreateDecodedResource("http://test/reused", 1000);
+  Persistent<FakeDecodedResource> unused =
+      CreateDecodedResource("http://test/unused", 1000);
+  GetMemoryCache()->Add(unused);
+  GetMemoryCache()->Add(reused);
+  GetMemoryCache()->DidLookUp(ResourceType::kMock, reused);
+
+  // Pruning the decoded data of one resource is enough.
+  GetMemoryCache()->SetCapacity(GetMemoryCache()->size() - 1);
+  EXPECT_GT(reused->DecodedSize(), 0u);
+  EXPECT_EQ(0u, unused->DecodedSize());
+}
+
+TEST_F(MemoryCacheTest, CostAwareEvictionPrunesLargerFirst) {
+  GetMemoryCache()->SetEvictionPolicyForTesting(
+      std::make_unique<CostAwareEvictionPolicy>());
+  GetMemoryCache()->SetDelayBeforeLiveDecodedPrune(base::TimeDelta());
+  Persistent<FakeDecodedResource> small =
+      CreateDecodedResource("http://test/small", 1000);
+  Persistent<FakeDecodedResource> large =
+      CreateDecodedResource("http://test/large", 4000);
+  GetMemoryCache()->Add(large);
+  GetMemoryCache()->Add(small);
+
+  GetMemoryCache()->SetCapacity(GetMemoryCache()->size() - 1);
+  EXPECT_GT(small->DecodedSize(), 0u);
+  EXPECT_EQ(0u, large->DecodedSize());
+}
+
+TEST_F(MemoryCacheTest, LookupStatistics) {
+  auto* resource = MakeGarbageCollected<FakeResource>("http://test/resource",
+                                                      ResourceType::kImage);
+  GetMemoryCache()->Add(resource);
+  GetMemoryCache()->DidLookUp(ResourceType::kImage, nullptr);
+  GetMemoryCache()->DidLookUp(ResourceType::kImage, resource);
+  GetMemoryCache()->DidLookUp(ResourceType::kScript, nullptr);
+
+  MemoryCache::Statistics stats = GetMemoryCache()->GetStatistics();
+  EXPECT_EQ(2u, stats.images.lookups);
+  EXPECT_EQ(1u, stats.images.hits);
+  EXPECT_EQ(1u, stats.scripts.lookups);
+  EXPECT_EQ(0u, stats.scripts.hits);
+  EXPECT_EQ(0u, stats.fonts.lookups);
+}
+
 }  // namespace blink
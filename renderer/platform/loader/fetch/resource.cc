@@ -35,6 +35,7 @@
 #include "base/time/default_clock.h"
 #include "build/build_config.h"
 #include "services/network/public/mojom/fetch_api.mojom-blink.h"
+#include "third_party/blink/public/common/features.h"
 #include "third_party/blink/public/platform/platform.h"
 #include "third_party/blink/public/platform/web_security_origin.h"
 #include "third_party/blink/renderer/platform/instrumentation/histogram.h"
@@ -216,11 +217,22 @@ void Resource::CheckResourceIntegrity() {
   // typically have a resource buffer, but we still need to check integrity
   // because people might want to assert a zero-length resource.
   CHECK(DecodedSize() == 0 || Data());
-  if (Data()) {
-    data = Data()->Data();
+  if (Data())
     data_length = Data()->size();
+
+  // If the body has already been hashed as it arrived, only compare digests.
+  // A mismatch is checked again below from the body, to report why.
+  std::unique_ptr<SubresourceIntegrity::IncrementalDigest> digest =
+      std::move(integrity_digest_);
+  if (digest && digest->size() == data_length &&
+      SubresourceIntegrity::CheckSubresourceIntegrity(
+          IntegrityMetadata(), *digest, *this, integrity_report_info_)) {
+    integrity_disposition_ = ResourceIntegrityDisposition::kPassed;
+    return;
   }
 
+  if (Data())
+    data = Data()->Data();
   if (SubresourceIntegrity::CheckSubresourceIntegrity(IntegrityMetadata(), data,
                                                       data_length, Url(), *this,
                                                       integrity_report_info_)) {
@@ -254,15 +266,34 @@ void Resource::AppendData(const char* data, size_t length) {
   DCHECK(!is_revalidating_);
   DCHECK(!ErrorOccurred());
   if (options_.data_buffering_policy == kBufferData) {
-    if (data_)
-      data_->Append(data, length);
-    else
-      data_ = SharedBuffer::Create(data, length);
+    if (!data_) {
+      data_ = SharedBuffer::Create();
+      ReserveResourceBuffer();
+      if (base::FeatureList::IsEnabled(
+              features::kIncrementalSubresourceIntegrity)) {
+        integrity_digest_ = SubresourceIntegrity::IncrementalDigest::Create(
+            IntegrityMetadata());
+      }
+    }
+    data_->Append(data, length);
+    if (integrity_digest_)
+      integrity_digest_->Update(base::make_span(data, length));
     SetEncodedSize(data_->size());
   }
   NotifyDataReceived(data, length);
 }
 
+void Resource::ReserveResourceBuffer() {
+  if (!base::FeatureList::IsEnabled(features::kContiguousResourceBuffer))
+    return;
+  // Content-Length is not trusted beyond this, and is the length of the
+  // encoded body, so a body that turns out to be longer continues in segments.
+  static constexpr int64_t kMaxReservedSize = 8 * 1024 * 1024;
+  int64_t expected_length = GetResponse().ExpectedContentLength();
+  if (expected_length > 0 && expected_length <= kMaxReservedSize)
+    data_->ReserveCapacity(static_cast<size_t>(expected_length));
+}
+
 void Resource::NotifyDataReceived(const char* data, size_t length) {
   ResourceClientWalker<ResourceClient> w(Clients());
   while (ResourceClient* c = w.Next())
@@ -274,11 +305,13 @@ void Resource::SetResourceBuffer(scoped_refptr<SharedBuffer> resource_buffer) {
   DCHECK(!ErrorOccurred());
   DCHECK_EQ(options_.data_buffering_policy, kBufferData);
   data_ = std::move(resource_buffer);
+  integrity_digest_.reset();
   SetEncodedSize(data_->size());
 }
 
 void Resource::ClearData() {
   data_ = nullptr;
+  integrity_digest_.reset();
   encoded_size_memory_usage_ = 0;
 }
 
@@ -903,8 +936,11 @@ void Resource::OnMemoryDump(WebMemoryDumpLevelOfDetail level_of_detail,
   else
     dump->AddScalar("dead_size", "bytes", encoded_size_memory_usage_);
 
-  if (data_)
+  if (data_) {
     GetSharedBufferMemoryDump(Data(), dump_name, memory_dump);
+    // The bytes of the body copied again after it was received.
+    dump->AddScalar("flattened_size", "bytes", data_->FlattenedSize());
+  }
 
   if (level_of_detail == WebMemoryDumpLevelOfDetail::kDetailed) {
     String url_to_report = Url().GetString();
@@ -500,6 +500,9 @@ class PLATFORM_EXPORT Resource : public GarbageCollected<Resource>,
 
   size_t CalculateOverheadSize() const;
 
+  // Reserves |data_| for the expected length of the response body.
+  void ReserveResourceBuffer();
+
   String ReasonNotDeletable() const;
 
   // MemoryPressureListener overrides:
@@ -533,6 +536,9 @@ class PLATFORM_EXPORT Resource : public GarbageCollected<Resource>,
 
   ResourceIntegrityDisposition integrity_disposition_;
   SubresourceIntegrity::ReportInfo integrity_report_info_;
+  // The digest of |data_| so far, if the integrity of |data_| is checked
+  // against digests and the IncrementalSubresourceIntegrity feature is on.
+  std::unique_ptr<SubresourceIntegrity::IncrementalDigest> integrity_digest_;
 
   // Ordered list of all redirects followed while fetching this resource.
   Vector<RedirectPair> redirect_chain_;
@@ -557,6 +557,7 @@ ResourceFetcher::ResourceFetcher(const ResourceFetcherInit& init)
           init.throttle_option_override,
           *properties_,
           init.frame_or_worker_scheduler,
+          task_runner_,
           *console_logger_)),
       archive_(init.archive),
       resource_timing_report_timer_(
@@ -1055,6 +1056,9 @@ Resource* ResourceFetcher::RequestResource(FetchParameters& params,
         policy = DetermineRevalidationPolicy(resource_type, params, *resource,
                                              is_static_data);
       }
+      GetMemoryCache()->DidLookUp(
+          resource_type,
+          policy == RevalidationPolicy::kUse ? resource : nullptr);
     }
   }
 
@@ -13,9 +13,11 @@
 #include "base/numerics/safe_conversions.h"
 #include "base/strings/string_number_conversions.h"
 #include "base/time/default_clock.h"
+#include "third_party/blink/public/common/features.h"
 #include "third_party/blink/public/mojom/devtools/console_message.mojom-blink.h"
 #include "third_party/blink/public/platform/platform.h"
 #include "third_party/blink/renderer/platform/instrumentation/histogram.h"
+#include "third_party/blink/renderer/platform/instrumentation/tracing/trace_event.h"
 #include "third_party/blink/renderer/platform/loader/fetch/console_logger.h"
 #include "third_party/blink/renderer/platform/loader/fetch/resource_fetcher_properties.h"
 #include "third_party/blink/renderer/platform/runtime_enabled_features.h"
@@ -79,6 +81,7 @@ ResourceLoadScheduler::ResourceLoadScheduler(
     ThrottleOptionOverride throttle_option_override,
     const DetachableResourceFetcherProperties& resource_fetcher_properties,
     FrameOrWorkerScheduler* frame_or_worker_scheduler,
+    scoped_refptr<base::SingleThreadTaskRunner> task_runner,
     DetachableConsoleLogger& console_logger)
     : resource_fetcher_properties_(resource_fetcher_properties),
       policy_(initial_throttling_policy),
@@ -86,7 +89,12 @@ ResourceLoadScheduler::ResourceLoadScheduler(
           resource_fetcher_properties_->GetOutstandingThrottledLimit()),
       console_logger_(console_logger),
       clock_(base::DefaultClock::GetInstance()),
-      throttle_option_override_(throttle_option_override) {
+      throttle_option_override_(throttle_option_override),
+      batch_scheduling_(
+          base::FeatureList::IsEnabled(features::kBatchResourceLoadScheduling)),
+      batch_timer_(std::move(task_runner),
+                   this,
+                   &ResourceLoadScheduler::RunBatch) {
   if (!frame_or_worker_scheduler)
     return;
 
@@ -128,6 +136,7 @@ void ResourceLoadScheduler::Shutdown() {
     return;
   is_shutdown_ = true;
 
+  batch_timer_.Stop();
   scheduler_observer_handle_.reset();
 }
 
@@ -146,9 +155,12 @@ void ResourceLoadScheduler::Request(ResourceLoadSchedulerClient* client,
     option = ThrottleOption::kThrottleable;
   }
 
-  // Check if the request can be throttled.
+  // Check if the request can be throttled. Requests that cannot be stopped
+  // or throttled are run synchronously even with batch scheduling.
   ClientIdWithPriority request_info(*id, priority, intra_priority);
-  if (!IsClientDelayable(option)) {
+  if (!IsClientDelayable(option) &&
+      (!batch_scheduling_ ||
+       option == ThrottleOption::kCanNotBeStoppedOrThrottled)) {
     Run(*id, client, false);
     return;
   }
@@ -322,6 +334,16 @@ void ResourceLoadScheduler::MaybeRun() {
   if (is_shutdown_)
     return;
 
+  if (batch_scheduling_) {
+    if (!batch_timer_.IsActive() && !pending_request_map_.IsEmpty())
+      batch_timer_.StartOneShot(base::TimeDelta(), FROM_HERE);
+    return;
+  }
+  RunPendingRequests();
+}
+
+size_t ResourceLoadScheduler::RunPendingRequests() {
+  size_t count = 0;
   ClientId id = kInvalidClientId;
   while (GetNextPendingRequest(&id)) {
     auto found = pending_request_map_.find(id);
@@ -331,7 +353,17 @@ void ResourceLoadScheduler::MaybeRun() {
     ThrottleOption option = found->value->option;
     pending_request_map_.erase(found);
     Run(id, client, option == ThrottleOption::kThrottleable);
+    ++count;
   }
+  return count;
+}
+
+void ResourceLoadScheduler::RunBatch(TimerBase*) {
+  DCHECK(batch_scheduling_);
+  TRACE_EVENT_BEGIN1("blink", "ResourceLoadScheduler::RunBatch", "pending",
+                     pending_request_map_.size());
+  size_t count = RunPendingRequests();
+  TRACE_EVENT_END1("blink", "ResourceLoadScheduler::RunBatch", "run", count);
 }
 
 void ResourceLoadScheduler::Run(ResourceLoadScheduler::ClientId id,
@@ -8,12 +8,15 @@
 #include <map>
 #include <set>
 
+#include "base/memory/scoped_refptr.h"
+#include "base/single_thread_task_runner.h"
 #include "base/time/time.h"
 #include "third_party/blink/renderer/platform/heap/garbage_collected.h"
 #include "third_party/blink/renderer/platform/heap/heap_allocator.h"
 #include "third_party/blink/renderer/platform/loader/fetch/resource.h"
 #include "third_party/blink/renderer/platform/loader/fetch/resource_loader_options.h"
 #include "third_party/blink/renderer/platform/scheduler/public/frame_scheduler.h"
+#include "third_party/blink/renderer/platform/timer.h"
 #include "third_party/blink/renderer/platform/wtf/hash_set.h"
 
 namespace base {
@@ -64,6 +67,13 @@ class PLATFORM_EXPORT ResourceLoadSchedulerClient
 //    activities more than its internal threshold (i.e., what
 //    GetOutstandingLimit() returns)".
 //
+// With the BatchResourceLoadScheduling feature, the requests that could be
+// run as soon as they are requested are queued too, except the ones that
+// cannot be stopped or throttled. The queued requests that can be run are run
+// together from a task posted when the first of them is requested, highest
+// priority first, so that the requests made by the same task are started in
+// priority order instead of in the order they were made.
+//
 //  ResourceLoadScheduler has two modes each of which has its own threshold.
 //   - Tight mode (used until the frame sees a <body> element):
 //     ResourceLoadScheduler considers a request throttleable if its priority
@@ -167,6 +177,7 @@ class PLATFORM_EXPORT ResourceLoadScheduler final
                         ThrottleOptionOverride throttle_option_override,
                         const DetachableResourceFetcherProperties&,
                         FrameOrWorkerScheduler*,
+                        scoped_refptr<base::SingleThreadTaskRunner>,
                         DetachableConsoleLogger& console_logger);
   ~ResourceLoadScheduler() override;
 
@@ -284,9 +295,15 @@ class PLATFORM_EXPORT ResourceLoadScheduler final
   // Generates the next ClientId.
   ClientId GenerateClientId();
 
-  // Picks up one client if there is a budget and route it to run.
+  // Picks up clients while there is a budget and routes them to run. With
+  // batch scheduling, makes sure that RunBatch() is called soon instead.
   void MaybeRun();
 
+  // Routes the clients that can run to run. Returns how many were run.
+  size_t RunPendingRequests();
+
+  void RunBatch(TimerBase*);
+
   // Grants a client to run,
   void Run(ClientId, ResourceLoadSchedulerClient*, bool throttleable);
 
@@ -352,6 +369,11 @@ class PLATFORM_EXPORT ResourceLoadScheduler final
 
   ThrottleOptionOverride throttle_option_override_;
 
+  // Whether the BatchResourceLoadScheduling feature is enabled.
+  const bool batch_scheduling_;
+
+  TaskRunnerTimer<ResourceLoadScheduler> batch_timer_;
+
   DISALLOW_COPY_AND_ASSIGN(ResourceLoadScheduler);
 };
 
@@ -0,0 +1,181 @@
+// Copyright 2020 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <memory>
+#include <string>
+#include <utility>
+
+#include "base/stl_util.h"
+#include "base/test/scoped_feature_list.h"
+#include "base/time/time.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+#include "third_party/blink/public/common/features.h"
+#include "third_party/blink/public/platform/platform.h"
+#include "third_party/blink/public/platform/web_url_loader.h"
+#include "third_party/blink/public/platform/web_url_loader_client.h"
+#include "third_party/blink/renderer/platform/heap/heap_allocator.h"
+#include "third_party/blink/renderer/platform/heap/persistent.h"
+#include "third_party/blink/renderer/platform/loader/fetch/raw_resource.h"
+#include "third_party/blink/renderer/platform/loader/fetch/resource_fetcher.h"
+#include "third_party/blink/renderer/platform/loader/fetch/resource_load_scheduler.h"
+#include "third_party/blink/renderer/platform/loader/testing/mock_fetch_context.h"
+#include "third_party/blink/renderer/platform/loader/testing/test_resource_fetcher_properties.h"
+#include "third_party/blink/renderer/platform/scheduler/test/fake_frame_scheduler.h"
+#include "third_party/blink/renderer/platform/scheduler/test/fake_task_runner.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
+
+namespace blink {
+
+namespace {
+
+constexpr char kMetricPrefixResourceLoadScheduler[] = "ResourceLoadScheduler.";
+constexpr char kMetricThroughput[] = "throughput";
+
+constexpr int kNumRounds = 20;
+constexpr wtf_size_t kNumRequests = 1000;
+
+using StartedLoads = Vector<WebURLLoaderClient*>;
+
+// Records the loads that the scheduler let start, without doing any network
+// work, so that the benchmark measures how fast requests are dispatched.
+class RecordingWebURLLoader final : public WebURLLoader {
+ public:
+  RecordingWebURLLoader(StartedLoads* started_loads,
+                        scoped_refptr<base::SingleThreadTaskRunner> task_runner)
+      : started_loads_(started_loads), task_runner_(std::move(task_runner)) {}
+  ~RecordingWebURLLoader() override = default;
+
+  void LoadSynchronously(
+      std::unique_ptr<network::ResourceRequest> request,
+      scoped_refptr<WebURLRequest::ExtraData> request_extra_data,
+      int requestor_id,
+      bool download_to_network_cache_only,
+      bool pass_response_pipe_to_client,
+      bool no_mime_sniffing,
+      base::TimeDelta timeout_interval,
+      WebURLLoaderClient*,
+      WebURLResponse&,
+      base::Optional<WebURLError>&,
+      WebData&,
+      int64_t& encoded_data_length,
+      int64_t& encoded_body_length,
+      WebBlobInfo& downloaded_blob) override {
+    NOTREACHED();
+  }
+  void LoadAsynchronously(
+      std::unique_ptr<network::ResourceRequest> request,
+      scoped_refptr<WebURLRequest::ExtraData> request_extra_data,
+      int requestor_id,
+      bool download_to_network_cache_only,
+      bool no_mime_sniffing,
+      WebURLLoaderClient* client) override {
+    started_loads_->push_back(client);
+  }
+  void SetDefersLoading(bool) override {}
+  void DidChangePriority(WebURLRequest::Priority, int) override {}
+  scoped_refptr<base::SingleThreadTaskRunner> GetTaskRunner() override {
+    return task_runner_;
+  }
+
+ private:
+  StartedLoads* started_loads_;
+  scoped_refptr<base::SingleThreadTaskRunner> task_runner_;
+};
+
+class RecordingLoaderFactory final : public ResourceFetcher::LoaderFactory {
+ public:
+  explicit RecordingLoaderFactory(StartedLoads* started_loads)
+      : started_loads_(started_loads) {}
+
+  std::unique_ptr<WebURLLoader> CreateURLLoader(
+      const ResourceRequest& request,
+      const ResourceLoaderOptions& options,
+      scoped_refptr<base::SingleThreadTaskRunner> task_runner) override {
+    return std::make_unique<RecordingWebURLLoader>(started_loads_,
+                                                   std::move(task_runner));
+  }
+  std::unique_ptr<CodeCacheLoader> CreateCodeCacheLoader() override {
+    return Platform::Current()->CreateCodeCacheLoader();
+  }
+
+ private:
+  StartedLoads* started_loads_;
+};
+
+// Fetches kNumRequests resources of mixed priorities from one task, as a
+// document with many subresources does before its first paint, when the
+// scheduler throttles loads tightly. Then runs the tasks of the fetcher and
+// finishes each load as soon as it starts, so that the throttled ones start
+// too.
+void RunBenchmark(const std::string& story_name, bool batch_scheduling) {
+  base::test::ScopedFeatureList feature_list;
+  feature_list.InitWithFeatureState(features::kBatchResourceLoadScheduling,
+                                    batch_scheduling);
+  perf_test::PerfResultReporter reporter(kMetricPrefixResourceLoadScheduler,
+                                         story_name);
+  reporter.RegisterImportantMetric(kMetricThroughput, "requests/s");
+
+  StartedLoads started_loads;
+  auto frame_scheduler = std::make_unique<scheduler::FakeFrameScheduler>();
+  auto task_runner = base::MakeRefCounted<scheduler::FakeTaskRunner>();
+  auto* properties = MakeGarbageCollected<TestResourceFetcherProperties>();
+  ResourceFetcherInit init(
+      properties->MakeDetachable(), MakeGarbageCollected<MockFetchContext>(),
+      task_runner,
+      MakeGarbageCollected<RecordingLoaderFactory>(&started_loads));
+  init.initial_throttling_policy =
+      ResourceLoadScheduler::ThrottlingPolicy::kTight;
+  init.frame_or_worker_scheduler = frame_scheduler.get();
+  Persistent<ResourceFetcher> fetcher =
+      MakeGarbageCollected<ResourceFetcher>(init);
+
+  const FetchParameters::DeferOption kDeferOptions[] = {
+      FetchParameters::kNoDefer, FetchParameters::kLazyLoad,
+      FetchParameters::kIdleLoad};
+
+  base::TimeDelta elapsed;
+  for (int round = 0; round < kNumRounds; ++round) {
+    Persistent<HeapVector<Member<Resource>>> resources =
+        MakeGarbageCollected<HeapVector<Member<Resource>>>();
+    started_loads.clear();
+    base::TimeTicks start = base::TimeTicks::Now();
+    for (wtf_size_t i = 0; i < kNumRequests; ++i) {
+      ResourceRequest request(KURL("https://example.test/" +
+                                   String::Number(round) + "/" +
+                                   String::Number(i)));
+      request.SetRequestContext(mojom::RequestContextType::FETCH);
+      FetchParameters params(std::move(request));
+      params.SetDefer(kDeferOptions[i % base::size(kDeferOptions)]);
+      resources->push_back(RawResource::Fetch(params, fetcher, nullptr));
+    }
+    // Finishing a load lets a throttled one start, from another batch with
+    // batch scheduling.
+    wtf_size_t finished = 0;
+    while (finished < kNumRequests) {
+      task_runner->RunUntilIdle();
+      ASSERT_GT(started_loads.size(), finished);
+      for (; finished < started_loads.size(); ++finished) {
+        started_loads[finished]->DidFinishLoading(base::TimeTicks(), 0, 0, 0,
+                                                  false);
+      }
+    }
+    elapsed += base::TimeTicks::Now() - start;
+  }
+  fetcher->ClearContext();
+  reporter.AddResult(kMetricThroughput,
+                     kNumRounds * kNumRequests / elapsed.InSecondsF());
+}
+
+TEST(ResourceLoadSchedulerPerfTest, ManyRequests) {
+  RunBenchmark("many_requests", false);
+}
+
+TEST(ResourceLoadSchedulerPerfTest, ManyRequestsWithBatchScheduling) {
+  RunBenchmark("many_requests_with_batch_scheduling", true);
+}
+
+}  // namespace
+
+}  // namespace blink
@@ -5,13 +5,16 @@
 #include "third_party/blink/renderer/platform/loader/fetch/resource_load_scheduler.h"
 
 #include <memory>
+#include "base/test/scoped_feature_list.h"
 #include "base/test/test_mock_time_task_runner.h"
 #include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/public/common/features.h"
 #include "third_party/blink/renderer/platform/heap/persistent.h"
 #include "third_party/blink/renderer/platform/loader/fetch/console_logger.h"
 #include "third_party/blink/renderer/platform/loader/testing/test_resource_fetcher_properties.h"
 #include "third_party/blink/renderer/platform/runtime_enabled_features.h"
 #include "third_party/blink/renderer/platform/scheduler/test/fake_frame_scheduler.h"
+#include "third_party/blink/renderer/platform/scheduler/test/fake_task_runner.h"
 #include "third_party/blink/renderer/platform/testing/testing_platform_support.h"
 #include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
 
@@ -93,10 +96,11 @@ class ResourceLoadSchedulerTest : public testing::Test {
     properties->SetShouldBlockLoadingSubResource(true);
     auto frame_scheduler = std::make_unique<scheduler::FakeFrameScheduler>();
     console_logger_ = MakeGarbageCollected<MockConsoleLogger>();
+    task_runner_ = base::MakeRefCounted<scheduler::FakeTaskRunner>();
     scheduler_ = MakeGarbageCollected<ResourceLoadScheduler>(
         ResourceLoadScheduler::ThrottlingPolicy::kTight,
         ResourceLoadScheduler::ThrottleOptionOverride::kNone,
-        properties->MakeDetachable(), frame_scheduler.get(),
+        properties->MakeDetachable(), frame_scheduler.get(), task_runner_,
         *MakeGarbageCollected<DetachableConsoleLogger>(console_logger_));
     Scheduler()->SetOutstandingLimitForTesting(1);
   }
@@ -104,6 +108,7 @@ class ResourceLoadSchedulerTest : public testing::Test {
 
   MockConsoleLogger* GetConsoleLogger() { return console_logger_; }
   ResourceLoadScheduler* Scheduler() { return scheduler_; }
+  scheduler::FakeTaskRunner* TaskRunner() { return task_runner_.get(); }
 
   bool Release(ResourceLoadScheduler::ClientId client) {
     return Scheduler()->Release(
@@ -118,9 +123,20 @@ class ResourceLoadSchedulerTest : public testing::Test {
 
  private:
   Persistent<MockConsoleLogger> console_logger_;
+  scoped_refptr<scheduler::FakeTaskRunner> task_runner_;
   Persistent<ResourceLoadScheduler> scheduler_;
 };
 
+class ResourceLoadSchedulerBatchTest : public ResourceLoadSchedulerTest {
+ public:
+  ResourceLoadSchedulerBatchTest() {
+    feature_list_.InitAndEnableFeature(features::kBatchResourceLoadScheduling);
+  }
+
+ private:
+  base::test::ScopedFeatureList feature_list_;
+};
+
 TEST_F(ResourceLoadSchedulerTest, StopStoppableRequest) {
   Scheduler()->OnLifecycleStateChanged(
       scheduler::SchedulingLifecycleState::kStopped);
@@ -694,5 +710,108 @@ TEST_F(ResourceLoadSchedulerTest, ConsoleMessage) {
   EXPECT_TRUE(Release(id2));
 }
 
+TEST_F(ResourceLoadSchedulerBatchTest, RequestsRunInPriorityOrder) {
+  Scheduler()->OnLifecycleStateChanged(
+      scheduler::SchedulingLifecycleState::kNotThrottled);
+  Scheduler()->SetOutstandingLimitForTesting(2);
+
+  MockClient::MockClientDelegate delegate;
+  MockClient* client1 = MakeGarbageCollected<MockClient>();
+  MockClient* client2 = MakeGarbageCollected<MockClient>();
+  MockClient* client3 = MakeGarbageCollected<MockClient>();
+  client1->SetDelegate(&delegate);
+  client2->SetDelegate(&delegate);
+  client3->SetDelegate(&delegate);
+
+  ResourceLoadScheduler::ClientId id1 = ResourceLoadScheduler::kInvalidClientId;
+  Scheduler()->Request(client1, ThrottleOption::kThrottleable,
+                       ResourceLoadPriority::kLowest, 0 /* intra_priority */,
+                       &id1);
+  ResourceLoadScheduler::ClientId id2 = ResourceLoadScheduler::kInvalidClientId;
+  Scheduler()->Request(client2, ThrottleOption::kStoppable,
+                       ResourceLoadPriority::kLow, 0 /* intra_priority */,
+                       &id2);
+  ResourceLoadScheduler::ClientId id3 = ResourceLoadScheduler::kInvalidClientId;
+  Scheduler()->Request(client3, ThrottleOption::kThrottleable,
+                       ResourceLoadPriority::kHigh, 0 /* intra_priority */,
+                       &id3);
+
+  // The requests could all run, but wait for the batch.
+  EXPECT_FALSE(client1->WasRun());
+  EXPECT_FALSE(client2->WasRun());
+  EXPECT_FALSE(client3->WasRun());
+
+  TaskRunner()->RunUntilIdle();
+  EXPECT_TRUE(client1->WasRun());
+  EXPECT_TRUE(client2->WasRun());
+  EXPECT_TRUE(client3->WasRun());
+
+  // Verify the requests ran by priority rather than in the requested order.
+  auto& order = delegate.client_order();
+  EXPECT_EQ(order[0], client3);
+  EXPECT_EQ(order[1], client2);
+  EXPECT_EQ(order[2], client1);
+
+  EXPECT_TRUE(Release(id1));
+  EXPECT_TRUE(Release(id2));
+  EXPECT_TRUE(Release(id3));
+}
+
+TEST_F(ResourceLoadSchedulerBatchTest, UnstoppableRequestRunsImmediately) {
+  Scheduler()->OnLifecycleStateChanged(
+      scheduler::SchedulingLifecycleState::kNotThrottled);
+
+  MockClient* client = MakeGarbageCollected<MockClient>();
+  ResourceLoadScheduler::ClientId id = ResourceLoadScheduler::kInvalidClientId;
+  Scheduler()->Request(client, ThrottleOption::kCanNotBeStoppedOrThrottled,
+                       ResourceLoadPriority::kLowest, 0 /* intra_priority */,
+                       &id);
+  EXPECT_NE(ResourceLoadScheduler::kInvalidClientId, id);
+  EXPECT_TRUE(client->WasRun());
+  EXPECT_TRUE(Release(id));
+}
+
+TEST_F(ResourceLoadSchedulerBatchTest, BatchesRespectOutstandingLimit) {
+  Scheduler()->OnLifecycleStateChanged(
+      scheduler::SchedulingLifecycleState::kNotThrottled);
+
+  MockClient* client1 = MakeGarbageCollected<MockClient>();
+  ResourceLoadScheduler::ClientId id1 = ResourceLoadScheduler::kInvalidClientId;
+  Scheduler()->Request(client1, ThrottleOption::kThrottleable,
+                       ResourceLoadPriority::kLowest, 0 /* intra_priority */,
+                       &id1);
+  MockClient* client2 = MakeGarbageCollected<MockClient>();
+  ResourceLoadScheduler::ClientId id2 = ResourceLoadScheduler::kInvalidClientId;
+  Scheduler()->Request(client2, ThrottleOption::kThrottleable,
+                       ResourceLoadPriority::kLowest, 0 /* intra_priority */,
+                       &id2);
+
+  // Only one throttleable request can be outstanding.
+  TaskRunner()->RunUntilIdle();
+  EXPECT_TRUE(client1->WasRun());
+  EXPECT_FALSE(client2->WasRun());
+
+  // Releasing the first request schedules the second one in another batch.
+  EXPECT_TRUE(ReleaseAndSchedule(id1));
+  EXPECT_FALSE(client2->WasRun());
+  TaskRunner()->RunUntilIdle();
+  EXPECT_TRUE(client2->WasRun());
+  EXPECT_TRUE(Release(id2));
+}
+
+TEST_F(ResourceLoadSchedulerBatchTest, ShutdownCancelsBatch) {
+  Scheduler()->OnLifecycleStateChanged(
+      scheduler::SchedulingLifecycleState::kNotThrottled);
+
+  MockClient* client = MakeGarbageCollected<MockClient>();
+  ResourceLoadScheduler::ClientId id = ResourceLoadScheduler::kInvalidClientId;
+  Scheduler()->Request(client, ThrottleOption::kThrottleable,
+                       ResourceLoadPriority::kHigh, 0 /* intra_priority */,
+                       &id);
+  Scheduler()->Shutdown();
+  TaskRunner()->RunUntilIdle();
+  EXPECT_FALSE(client->WasRun());
+}
+
 }  // namespace
 }  // namespace blink
@@ -4,9 +4,12 @@
 
 #include "third_party/blink/renderer/platform/loader/fetch/resource.h"
 
+#include "base/test/scoped_feature_list.h"
 #include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/public/common/features.h"
 #include "third_party/blink/public/platform/platform.h"
 #include "third_party/blink/renderer/platform/loader/fetch/memory_cache.h"
+#include "third_party/blink/renderer/platform/loader/fetch/resource_loader_options.h"
 #include "third_party/blink/renderer/platform/loader/fetch/resource_request.h"
 #include "third_party/blink/renderer/platform/loader/fetch/resource_response.h"
 #include "third_party/blink/renderer/platform/loader/testing/mock_resource.h"
@@ -582,4 +585,65 @@ TEST(ResourceTest, DefaultOverheadSize) {
   EXPECT_EQ(resource->CalculateOverheadSizeForTest(), resource->OverheadSize());
 }
 
+TEST(ResourceTest, ContiguousResourceBuffer) {
+  base::test::ScopedFeatureList feature_list;
+  feature_list.InitAndEnableFeature(features::kContiguousResourceBuffer);
+  const KURL url("http://test.example.com/");
+  auto* resource = MakeGarbageCollected<MockResource>(url);
+  Vector<char> data(SharedBuffer::kSegmentSize * 4);
+  ResourceResponse response(url);
+  response.SetHttpStatusCode(200);
+  response.SetExpectedContentLength(data.size());
+  resource->ResponseReceived(response);
+  for (wtf_size_t offset = 0; offset < data.size(); offset += 100) {
+    resource->AppendData(data.data() + offset,
+                         std::min<size_t>(100, data.size() - offset));
+  }
+  resource->FinishForTest();
+
+  scoped_refptr<const SharedBuffer> buffer = resource->ResourceBuffer();
+  ASSERT_TRUE(buffer);
+  EXPECT_EQ(data.size(), buffer->size());
+  EXPECT_EQ(++buffer->begin(), buffer->end());
+  const SharedBuffer::DeprecatedFlatData flat_data(buffer);
+  EXPECT_EQ(0u, buffer->FlattenedSize());
+}
+
+TEST(ResourceTest, IncrementalSubresourceIntegrity) {
+  base::test::ScopedFeatureList feature_list;
+  feature_list.InitAndEnableFeature(
+      features::kIncrementalSubresourceIntegrity);
+  const KURL url("http://test.example.com/");
+  const char kContent[] = "alert('test');";
+  const struct {
+    const char* integrity;
+    ResourceIntegrityDisposition disposition;
+  } cases[] = {
+      {"sha256-GAF48QOoxRvu0gZAmQivUdJPyBacqznBAXwnkfpmQX4=",
+       ResourceIntegrityDisposition::kPassed},
+      {"sha256-deadbeef", ResourceIntegrityDisposition::kFailed},
+  };
+  for (const auto& test : cases) {
+    SCOPED_TRACE(test.integrity);
+    ResourceLoaderOptions options;
+    SubresourceIntegrity::ParseIntegrityAttribute(
+        test.integrity, SubresourceIntegrity::IntegrityFeatures::kDefault,
+        options.integrity_metadata);
+    ResourceRequest request(url);
+    auto* resource = MakeGarbageCollected<MockResource>(request, options);
+    ResourceResponse response(url);
+    response.SetHttpStatusCode(200);
+    resource->ResponseReceived(response);
+    resource->AppendData(kContent, 5);
+    resource->AppendData(kContent + 5, strlen(kContent) - 5);
+    resource->FinishForTest();
+
+    EXPECT_EQ(test.disposition, resource->IntegrityDisposition());
+    // A mismatch is reported just as when the body is hashed all at once.
+    const auto& report_info = resource->IntegrityReportInfo();
+    EXPECT_EQ(test.disposition == ResourceIntegrityDisposition::kFailed,
+              !report_info.ConsoleErrorMessages().IsEmpty());
+  }
+}
+
 }  // namespace blink
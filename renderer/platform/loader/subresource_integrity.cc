@@ -66,6 +66,32 @@ void SubresourceIntegrity::ReportInfo::Clear() {
   console_error_messages_.clear();
 }
 
+// static
+std::unique_ptr<SubresourceIntegrity::IncrementalDigest>
+SubresourceIntegrity::IncrementalDigest::Create(
+    const IntegrityMetadataSet& metadata_set) {
+  if (metadata_set.IsEmpty())
+    return nullptr;
+  IntegrityAlgorithm algorithm = FindBestAlgorithm(metadata_set);
+  if (algorithm == IntegrityAlgorithm::kEd25519)
+    return nullptr;
+  return std::make_unique<IncrementalDigest>(algorithm);
+}
+
+SubresourceIntegrity::IncrementalDigest::IncrementalDigest(
+    IntegrityAlgorithm algorithm)
+    : algorithm_(algorithm), digestor_(HashAlgorithmForDigest(algorithm)) {}
+
+void SubresourceIntegrity::IncrementalDigest::Update(
+    base::span<const char> data) {
+  digestor_.Update(base::as_bytes(data));
+  size_ += data.size();
+}
+
+bool SubresourceIntegrity::IncrementalDigest::Finish(DigestValue& digest) {
+  return digestor_.Finish(digest);
+}
+
 bool SubresourceIntegrity::CheckSubresourceIntegrity(
     const IntegrityMetadataSet& metadata_set,
     const char* content,
@@ -93,6 +119,31 @@ bool SubresourceIntegrity::CheckSubresourceIntegrity(
       resource.GetResponse().HttpHeaderField("Integrity"), report_info);
 }
 
+bool SubresourceIntegrity::CheckSubresourceIntegrity(
+    const IntegrityMetadataSet& metadata_set,
+    IncrementalDigest& incremental_digest,
+    const Resource& resource,
+    ReportInfo& report_info) {
+  if (!resource.GetResponse().IsCorsSameOrigin() || metadata_set.IsEmpty())
+    return false;
+
+  IntegrityAlgorithm max_algorithm = FindBestAlgorithm(metadata_set);
+  if (max_algorithm != incremental_digest.Algorithm())
+    return false;
+  DigestValue digest;
+  if (!incremental_digest.Finish(digest))
+    return false;
+  for (const IntegrityMetadata& metadata : metadata_set) {
+    if (metadata.Algorithm() == max_algorithm &&
+        DigestMatches(metadata, digest)) {
+      report_info.AddUseCount(ReportInfo::UseCounterFeature::
+                                  kSRIElementWithMatchingIntegrityAttribute);
+      return true;
+    }
+  }
+  return false;
+}
+
 bool SubresourceIntegrity::CheckSubresourceIntegrity(
     const String& integrity_metadata,
     IntegrityFeatures features,
@@ -207,31 +258,24 @@ SubresourceIntegrity::GetCheckFunctionForAlgorithm(
   return nullptr;
 }
 
-bool SubresourceIntegrity::CheckSubresourceIntegrityDigest(
-    const IntegrityMetadata& metadata,
-    const char* content,
-    size_t size,
-    const String& integrity_header) {
-  blink::HashAlgorithm hash_algo = kHashAlgorithmSha256;
-  switch (metadata.Algorithm()) {
+HashAlgorithm SubresourceIntegrity::HashAlgorithmForDigest(
+    IntegrityAlgorithm algorithm) {
+  switch (algorithm) {
     case IntegrityAlgorithm::kSha256:
-      hash_algo = kHashAlgorithmSha256;
-      break;
+      return kHashAlgorithmSha256;
     case IntegrityAlgorithm::kSha384:
-      hash_algo = kHashAlgorithmSha384;
-      break;
+      return kHashAlgorithmSha384;
     case IntegrityAlgorithm::kSha512:
-      hash_algo = kHashAlgorithmSha512;
-      break;
+      return kHashAlgorithmSha512;
     case IntegrityAlgorithm::kEd25519:
-      NOTREACHED();
       break;
   }
+  NOTREACHED();
+  return kHashAlgorithmSha256;
+}
 
-  DigestValue digest;
-  if (!ComputeDigest(hash_algo, content, size, digest))
-    return false;
-
+bool SubresourceIntegrity::DigestMatches(const IntegrityMetadata& metadata,
+                                         const DigestValue& digest) {
   Vector<char> hash_vector;
   Base64Decode(metadata.Digest(), hash_vector);
   DigestValue converted_hash_vector;
@@ -240,6 +284,19 @@ bool SubresourceIntegrity::CheckSubresourceIntegrityDigest(
   return DigestsEqual(digest, converted_hash_vector);
 }
 
+bool SubresourceIntegrity::CheckSubresourceIntegrityDigest(
+    const IntegrityMetadata& metadata,
+    const char* content,
+    size_t size,
+    const String& integrity_header) {
+  DigestValue digest;
+  if (!ComputeDigest(HashAlgorithmForDigest(metadata.Algorithm()), content,
+                     size, digest)) {
+    return false;
+  }
+  return DigestMatches(metadata, digest);
+}
+
 bool SubresourceIntegrity::CheckSubresourceIntegritySignature(
     const IntegrityMetadata& metadata,
     const char* content,
@@ -5,7 +5,12 @@
 #ifndef THIRD_PARTY_BLINK_RENDERER_PLATFORM_LOADER_SUBRESOURCE_INTEGRITY_H_
 #define THIRD_PARTY_BLINK_RENDERER_PLATFORM_LOADER_SUBRESOURCE_INTEGRITY_H_
 
+#include <memory>
+
+#include "base/containers/span.h"
 #include "base/gtest_prod_util.h"
+#include "base/macros.h"
+#include "third_party/blink/renderer/platform/crypto.h"
 #include "third_party/blink/renderer/platform/loader/fetch/integrity_metadata.h"
 #include "third_party/blink/renderer/platform/platform_export.h"
 #include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
@@ -48,6 +53,37 @@ class PLATFORM_EXPORT SubresourceIntegrity final {
     Vector<String> console_error_messages_;
   };
 
+  // Hashes a content with the strongest algorithm of an IntegrityMetadataSet
+  // as the content arrives, so that checking it once it has fully arrived only
+  // compares digests.
+  class PLATFORM_EXPORT IncrementalDigest final {
+    USING_FAST_MALLOC(IncrementalDigest);
+
+   public:
+    // Returns null if |metadata_set| is empty or its strongest algorithm is a
+    // signature algorithm, which needs the whole content to check.
+    static std::unique_ptr<IncrementalDigest> Create(
+        const IntegrityMetadataSet& metadata_set);
+
+    explicit IncrementalDigest(IntegrityAlgorithm);
+
+    void Update(base::span<const char>);
+    // Returns false if the digest could not be computed. Must not be called
+    // twice, nor followed by Update().
+    bool Finish(DigestValue&);
+
+    IntegrityAlgorithm Algorithm() const { return algorithm_; }
+    // The number of bytes of the content hashed so far.
+    size_t size() const { return size_; }
+
+   private:
+    const IntegrityAlgorithm algorithm_;
+    Digestor digestor_;
+    size_t size_ = 0;
+
+    DISALLOW_COPY_AND_ASSIGN(IncrementalDigest);
+  };
+
   enum IntegrityParseResult {
     kIntegrityParseValidResult,
     kIntegrityParseNoValidResult
@@ -68,6 +104,13 @@ class PLATFORM_EXPORT SubresourceIntegrity final {
                                         const KURL& resource_url,
                                         const Resource&,
                                         ReportInfo&);
+  // Same as above, but with the content already hashed by |digest|. This only
+  // reports to |report_info| when it returns true; otherwise the caller checks
+  // the content with the version above, which reports why it failed.
+  static bool CheckSubresourceIntegrity(const IntegrityMetadataSet&,
+                                        IncrementalDigest& digest,
+                                        const Resource&,
+                                        ReportInfo& report_info);
   static bool CheckSubresourceIntegrity(const String&,
                                         IntegrityFeatures,
                                         const char* content,
@@ -112,6 +155,8 @@ class PLATFORM_EXPORT SubresourceIntegrity final {
   };
 
   static IntegrityAlgorithm FindBestAlgorithm(const IntegrityMetadataSet&);
+  static HashAlgorithm HashAlgorithmForDigest(IntegrityAlgorithm);
+  static bool DigestMatches(const IntegrityMetadata&, const DigestValue&);
 
   typedef bool (*CheckFunction)(const IntegrityMetadata&,
                                 const char*,
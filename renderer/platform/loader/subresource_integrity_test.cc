@@ -208,12 +208,26 @@ class SubresourceIntegrityTest : public testing::Test {
                   String(integrity), Features(), metadata_set));
 
     SubresourceIntegrity::ReportInfo report_info;
+    Resource* resource =
+        CreateTestResource(test.url, test.request_mode, test.response_type);
     EXPECT_EQ(expectation == kIntegritySuccess,
               SubresourceIntegrity::CheckSubresourceIntegrity(
                   metadata_set, kBasicScript, strlen(kBasicScript), test.url,
-                  *CreateTestResource(test.url, test.request_mode,
-                                      test.response_type),
-                  report_info));
+                  *resource, report_info));
+
+    // The same check with the content hashed in two chunks.
+    std::unique_ptr<SubresourceIntegrity::IncrementalDigest> digest =
+        SubresourceIntegrity::IncrementalDigest::Create(metadata_set);
+    if (!digest)
+      return;
+    base::span<const char> content(kBasicScript, strlen(kBasicScript));
+    digest->Update(content.first(5));
+    digest->Update(content.subspan(5));
+    EXPECT_EQ(strlen(kBasicScript), digest->size());
+    SubresourceIntegrity::ReportInfo incremental_report_info;
+    EXPECT_EQ(expectation == kIntegritySuccess,
+              SubresourceIntegrity::CheckSubresourceIntegrity(
+                  metadata_set, *digest, *resource, incremental_report_info));
   }
 
   Resource* CreateTestResource(
@@ -605,6 +619,22 @@ TEST_F(SubresourceIntegrityTest, FindBestAlgorithm) {
                                       {"", IntegrityAlgorithm::kEd25519}})));
 }
 
+TEST_F(SubresourceIntegrityTest, CreateIncrementalDigest) {
+  EXPECT_FALSE(
+      SubresourceIntegrity::IncrementalDigest::Create(IntegrityMetadataSet()));
+  EXPECT_FALSE(SubresourceIntegrity::IncrementalDigest::Create(
+      IntegrityMetadataSet({{"", IntegrityAlgorithm::kSha256},
+                            {"", IntegrityAlgorithm::kEd25519}})));
+
+  std::unique_ptr<SubresourceIntegrity::IncrementalDigest> digest =
+      SubresourceIntegrity::IncrementalDigest::Create(
+          IntegrityMetadataSet({{"", IntegrityAlgorithm::kSha256},
+                                {"", IntegrityAlgorithm::kSha384}}));
+  ASSERT_TRUE(digest);
+  EXPECT_EQ(IntegrityAlgorithm::kSha384, digest->Algorithm());
+  EXPECT_EQ(0u, digest->size());
+}
+
 TEST_F(SubresourceIntegrityTest, GetCheckFunctionForAlgorithm) {
   EXPECT_TRUE(SubresourceIntegrity::CheckSubresourceIntegrityDigest ==
               SubresourceIntegrity::GetCheckFunctionForAlgorithm(
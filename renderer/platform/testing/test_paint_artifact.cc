@@ -77,6 +77,14 @@ TestPaintArtifact& TestPaintArtifact::ScrollHitTest(
   return ScrollHitTest(NewClient(), scroll_translation);
 }
 
+TestPaintArtifact& TestPaintArtifact::HitTestTouchAction(
+    const IntRect& rect,
+    TouchAction allowed_touch_action) {
+  paint_chunks_.back().EnsureHitTestData().touch_action_rects.push_back(
+      TouchActionRect{rect, allowed_touch_action});
+  return *this;
+}
+
 TestPaintArtifact& TestPaintArtifact::ForeignLayer(
     scoped_refptr<cc::Layer> layer,
     const FloatPoint& offset) {
@@ -10,6 +10,7 @@
 #include "third_party/blink/renderer/platform/graphics/color.h"
 #include "third_party/blink/renderer/platform/graphics/paint/display_item_list.h"
 #include "third_party/blink/renderer/platform/graphics/paint/paint_artifact.h"
+#include "third_party/blink/renderer/platform/graphics/touch_action.h"
 #include "third_party/blink/renderer/platform/testing/fake_display_item_client.h"
 #include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
 #include "third_party/blink/renderer/platform/wtf/vector.h"
@@ -105,6 +106,9 @@ class TestPaintArtifact {
   TestPaintArtifact& RectDrawing(const IntRect& bounds, Color color);
   TestPaintArtifact& ScrollHitTest(
       const TransformPaintPropertyNode* scroll_translation);
+  // Adds a touch action rect to the hit test data of the chunk.
+  TestPaintArtifact& HitTestTouchAction(const IntRect& rect,
+                                        TouchAction allowed_touch_action);
 
   TestPaintArtifact& ForeignLayer(scoped_refptr<cc::Layer> layer,
                                   const FloatPoint& offset);
@@ -0,0 +1,189 @@
+// Copyright 2020 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/platform/wtf/allocator/lifecycle_arena.h"
+
+#include <new>
+
+#include "third_party/blink/renderer/platform/wtf/allocator/partitions.h"
+#include "third_party/blink/renderer/platform/wtf/threading.h"
+
+namespace WTF {
+
+namespace {
+
+// Allocations larger than this get a chunk of their own, so that they do not
+// waste the rest of the current chunk.
+constexpr size_t kMaxSharedChunkAllocationSize = LifecycleArena::kChunkSize / 4;
+
+// Precedes each backing of LifecycleArenaAllocator, so that freeing a backing
+// doesn't have to look it up in the chunks of the arena.
+struct BackingHeader {
+  bool in_arena;
+};
+
+// Keeps the backings aligned.
+constexpr size_t kBackingHeaderSize = LifecycleArena::kAlignment;
+static_assert(sizeof(BackingHeader) <= kBackingHeaderSize,
+              "BackingHeader must fit in kBackingHeaderSize");
+
+BackingHeader* HeaderOf(void* backing) {
+  return reinterpret_cast<BackingHeader*>(static_cast<uint8_t*>(backing) -
+                                          kBackingHeaderSize);
+}
+
+}  // namespace
+
+LifecycleArena::Scope::Scope() : arena_(Current()) {
+  ++arena_.scope_depth_;
+}
+
+LifecycleArena::Scope::~Scope() {
+  DCHECK(arena_.scope_depth_);
+  if (--arena_.scope_depth_)
+    return;
+  // A container that allocated from the arena outlives the scope. Its backing
+  // would alias the next allocations.
+  CHECK_EQ(0u, arena_.live_allocations_);
+  arena_.Reset();
+}
+
+LifecycleArena::LifecycleArena() = default;
+
+LifecycleArena::~LifecycleArena() {
+  DCHECK(!scope_depth_);
+  for (const Chunk& chunk : chunks_)
+    Partitions::BufferFree(chunk.base);
+}
+
+// static
+LifecycleArena& LifecycleArena::Current() {
+  return WtfThreading().GetLifecycleArena();
+}
+
+void* LifecycleArena::Allocate(size_t size) {
+  DCHECK(IsActive());
+  size = RoundUpToAlignment(size);
+  ++stats_.arena_allocations;
+  stats_.allocated_bytes += size;
+  ++live_allocations_;
+  if (size > static_cast<size_t>(end_ - current_))
+    return AllocateFromNewChunk(size);
+  last_allocation_ = current_;
+  current_ += size;
+  return last_allocation_;
+}
+
+void* LifecycleArena::AllocateFromNewChunk(size_t size) {
+  const bool dedicated = size > kMaxSharedChunkAllocationSize;
+  const size_t chunk_size = dedicated ? size : kChunkSize;
+  auto* base = static_cast<uint8_t*>(
+      Partitions::BufferMalloc(chunk_size, "LifecycleArena"));
+  chunks_.push_back(Chunk{base, chunk_size});
+  ++stats_.chunk_allocations;
+  if (dedicated)
+    return base;
+  last_allocation_ = base;
+  current_ = base + size;
+  end_ = base + chunk_size;
+  return base;
+}
+
+bool LifecycleArena::Expand(void* address, size_t new_size) {
+  if (!address || address != last_allocation_)
+    return false;
+  uint8_t* new_end =
+      static_cast<uint8_t*>(address) + RoundUpToAlignment(new_size);
+  if (new_end > end_)
+    return false;
+  if (new_end > current_)
+    current_ = new_end;
+  ++stats_.in_place_expansions;
+  return true;
+}
+
+void LifecycleArena::Free(void* address) {
+  DCHECK(Contains(address));
+  DCHECK(live_allocations_);
+  --live_allocations_;
+  // Give the memory of the most recent allocation back to the chunk.
+  if (address == last_allocation_) {
+    current_ = static_cast<uint8_t*>(address);
+    last_allocation_ = nullptr;
+  }
+}
+
+bool LifecycleArena::Contains(const void* address) const {
+  const auto* byte = static_cast<const uint8_t*>(address);
+  for (const Chunk& chunk : chunks_) {
+    if (byte >= chunk.base && byte < chunk.base + chunk.size)
+      return true;
+  }
+  return false;
+}
+
+void LifecycleArena::Reset() {
+  DCHECK(!scope_depth_);
+  if (chunks_.IsEmpty())
+    return;
+  for (wtf_size_t i = 1; i < chunks_.size(); ++i)
+    Partitions::BufferFree(chunks_[i].base);
+  chunks_.Shrink(1);
+  // The first chunk may be a dedicated one; only reuse regular chunks.
+  if (chunks_[0].size != kChunkSize) {
+    Partitions::BufferFree(chunks_[0].base);
+    chunks_.clear();
+    current_ = end_ = nullptr;
+  } else {
+    current_ = chunks_[0].base;
+    end_ = current_ + kChunkSize;
+  }
+  last_allocation_ = nullptr;
+}
+
+// static
+void* LifecycleArenaAllocator::AllocateBacking(size_t size) {
+  LifecycleArena& arena = LifecycleArena::Current();
+  const bool in_arena = arena.IsActive();
+  void* block =
+      in_arena ? arena.Allocate(kBackingHeaderSize + size)
+               : Partitions::BufferMalloc(kBackingHeaderSize + size,
+                                          "LifecycleArenaAllocator");
+  new (block) BackingHeader{in_arena};
+  return static_cast<uint8_t*>(block) + kBackingHeaderSize;
+}
+
+// static
+void LifecycleArenaAllocator::FreeBacking(void* address) {
+  if (!address)
+    return;
+  BackingHeader* header = HeaderOf(address);
+  if (header->in_arena)
+    LifecycleArena::Current().Free(header);
+  else
+    Partitions::BufferFree(header);
+}
+
+// static
+bool LifecycleArenaAllocator::ExpandVectorBacking(void* address,
+                                                  size_t new_size) {
+  if (!address || !HeaderOf(address)->in_arena)
+    return false;
+  return LifecycleArena::Current().Expand(HeaderOf(address),
+                                          kBackingHeaderSize + new_size);
+}
+
+// static
+bool LifecycleArenaAllocator::ShrinkVectorBacking(
+    void* address,
+    size_t quantized_current_size,
+    size_t quantized_shrunk_size) {
+  // Arena backings shrink in place; the memory is reclaimed with the arena.
+  if (HeaderOf(address)->in_arena)
+    return true;
+  return PartitionAllocator::ShrinkVectorBacking(
+      address, quantized_current_size, quantized_shrunk_size);
+}
+
+}  // namespace WTF
@@ -0,0 +1,164 @@
+// Copyright 2020 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef THIRD_PARTY_BLINK_RENDERER_PLATFORM_WTF_ALLOCATOR_LIFECYCLE_ARENA_H_
+#define THIRD_PARTY_BLINK_RENDERER_PLATFORM_WTF_ALLOCATOR_LIFECYCLE_ARENA_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "base/macros.h"
+#include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
+#include "third_party/blink/renderer/platform/wtf/allocator/partition_allocator.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
+#include "third_party/blink/renderer/platform/wtf/wtf_export.h"
+
+namespace WTF {
+
+// A per-thread bump allocator for the backings of temporary containers that
+// do not outlive a rendering lifecycle phase, such as layout and style
+// scratch vectors. A LifecycleArena::Scope marks such a phase. While a scope
+// is active, containers using LifecycleArenaAllocator take their backings
+// from the arena, freeing a backing is a no-op, and the arena releases all
+// backings in bulk when the outermost scope ends. Outside of scopes,
+// LifecycleArenaAllocator falls back to PartitionAlloc.
+//
+// A container must be destroyed before the end of the outermost scope that
+// was active when it allocated its backing. This is CHECKed, since the
+// backing would otherwise alias later allocations.
+class WTF_EXPORT LifecycleArena final {
+  USING_FAST_MALLOC(LifecycleArena);
+
+ public:
+  struct Stats {
+    // Backings served from the arena. Each one replaces a PartitionAlloc
+    // allocation and the corresponding free.
+    size_t arena_allocations = 0;
+    // Vector backings that grew in place instead of being reallocated.
+    size_t in_place_expansions = 0;
+    // PartitionAlloc allocations made for the chunks of the arena.
+    size_t chunk_allocations = 0;
+    size_t allocated_bytes = 0;
+  };
+
+  class WTF_EXPORT Scope final {
+    STACK_ALLOCATED();
+
+   public:
+    Scope();
+    ~Scope();
+
+   private:
+    LifecycleArena& arena_;
+
+    DISALLOW_COPY_AND_ASSIGN(Scope);
+  };
+
+  // Backings are aligned like PartitionAlloc allocations.
+  static constexpr size_t kAlignment = 16;
+  static constexpr size_t kChunkSize = 64 * 1024;
+
+  LifecycleArena();
+  ~LifecycleArena();
+
+  // The arena of the current thread.
+  static LifecycleArena& Current();
+
+  static size_t RoundUpToAlignment(size_t size) {
+    return (size + kAlignment - 1) & ~(kAlignment - 1);
+  }
+
+  bool IsActive() const { return scope_depth_; }
+
+  // Allocates at least |size| bytes. Must only be called while a scope is
+  // active.
+  void* Allocate(size_t size);
+
+  // Grows the allocation at |address| to |new_size| bytes if it is the most
+  // recent allocation and its chunk has room.
+  bool Expand(void* address, size_t new_size);
+
+  // Records that the allocation at |address| is no longer used. Only the most
+  // recent allocation is reclaimed right away; the rest of the memory is
+  // reclaimed when the outermost scope ends.
+  void Free(void* address);
+
+  // Looks |address| up in all chunks. Only meant for DCHECKs and tests.
+  bool Contains(const void* address) const;
+
+  const Stats& GetStats() const { return stats_; }
+  void ResetStatsForTesting() { stats_ = Stats(); }
+
+ private:
+  struct Chunk {
+    uint8_t* base;
+    size_t size;
+  };
+
+  void* AllocateFromNewChunk(size_t size);
+  // Frees all chunks but the first one, which is kept for the next scope.
+  void Reset();
+
+  Vector<Chunk> chunks_;
+  uint8_t* current_ = nullptr;
+  uint8_t* end_ = nullptr;
+  void* last_allocation_ = nullptr;
+  unsigned scope_depth_ = 0;
+  size_t live_allocations_ = 0;
+  Stats stats_;
+
+  DISALLOW_COPY_AND_ASSIGN(LifecycleArena);
+};
+
+// An allocator policy for Vector, HashMap and HashSet that allocates backings
+// from the LifecycleArena of the current thread, e.g.
+//
+//   Vector<LayoutUnit, 0, LifecycleArenaAllocator> scratch;
+//
+// Like PartitionAllocator, the container objects themselves are not
+// allocated from the arena. Each backing is preceded by a small header that
+// tells whether it came from the arena or from PartitionAlloc.
+class WTF_EXPORT LifecycleArenaAllocator : public PartitionAllocator {
+ public:
+  static constexpr bool kCanExpandVectorBackingInPlace = true;
+
+  template <typename T>
+  static size_t QuantizedSize(size_t count) {
+    CHECK_LE(count, MaxElementCountInBackingStore<T>());
+    return LifecycleArena::RoundUpToAlignment(count * sizeof(T));
+  }
+  template <typename T>
+  static T* AllocateVectorBacking(size_t size) {
+    return reinterpret_cast<T*>(AllocateBacking(size));
+  }
+  static void FreeVectorBacking(void* address) { FreeBacking(address); }
+  static bool ExpandVectorBacking(void* address, size_t new_size);
+  static bool ShrinkVectorBacking(void* address,
+                                  size_t quantized_current_size,
+                                  size_t quantized_shrunk_size);
+
+  template <typename T, typename HashTable>
+  static T* AllocateHashTableBacking(size_t size) {
+    return reinterpret_cast<T*>(AllocateBacking(size));
+  }
+  template <typename T, typename HashTable>
+  static T* AllocateZeroedHashTableBacking(size_t size) {
+    void* result = AllocateBacking(size);
+    memset(result, 0, size);
+    return reinterpret_cast<T*>(result);
+  }
+  static void FreeHashTableBacking(void* address) { FreeBacking(address); }
+
+ private:
+  static void* AllocateBacking(size_t);
+  static void FreeBacking(void*);
+};
+
+}  // namespace WTF
+
+using WTF::LifecycleArena;
+using WTF::LifecycleArenaAllocator;
+
+#endif  // THIRD_PARTY_BLINK_RENDERER_PLATFORM_WTF_ALLOCATOR_LIFECYCLE_ARENA_H_
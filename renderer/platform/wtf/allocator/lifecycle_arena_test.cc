@@ -0,0 +1,131 @@
+// Copyright 2020 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/platform/wtf/allocator/lifecycle_arena.h"
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/renderer/platform/wtf/hash_map.h"
+#include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
+
+namespace WTF {
+
+namespace {
+
+using ArenaVector = Vector<int, 0, LifecycleArenaAllocator>;
+using ArenaHashMap = HashMap<int,
+                             String,
+                             DefaultHash<int>::Hash,
+                             HashTraits<int>,
+                             HashTraits<String>,
+                             LifecycleArenaAllocator>;
+
+class LifecycleArenaTest : public testing::Test {
+ protected:
+  void SetUp() override { Arena().ResetStatsForTesting(); }
+
+  LifecycleArena& Arena() { return LifecycleArena::Current(); }
+};
+
+TEST_F(LifecycleArenaTest, FallsBackToPartitionAllocOutsideScopes) {
+  EXPECT_FALSE(Arena().IsActive());
+  ArenaVector vector;
+  vector.push_back(1);
+  EXPECT_FALSE(Arena().Contains(vector.data()));
+  EXPECT_EQ(0u, Arena().GetStats().arena_allocations);
+}
+
+TEST_F(LifecycleArenaTest, VectorBackingsComeFromTheArena) {
+  LifecycleArena::Scope scope;
+  EXPECT_TRUE(Arena().IsActive());
+  ArenaVector vector;
+  for (int i = 0; i < 1000; ++i)
+    vector.push_back(i);
+  EXPECT_TRUE(Arena().Contains(vector.data()));
+  for (int i = 0; i < 1000; ++i)
+    EXPECT_EQ(i, vector[i]);
+
+  // The vector is the most recent allocation, so it grows in place.
+  EXPECT_GT(Arena().GetStats().in_place_expansions, 0u);
+  EXPECT_LT(Arena().GetStats().arena_allocations, 5u);
+
+  vector.Shrink(10);
+  vector.ShrinkToFit();
+  EXPECT_TRUE(Arena().Contains(vector.data()));
+  EXPECT_EQ(9, vector.back());
+}
+
+TEST_F(LifecycleArenaTest, HashMapBackingsComeFromTheArena) {
+  LifecycleArena::Scope scope;
+  ArenaHashMap map;
+  for (int i = 1; i <= 500; ++i)
+    map.insert(i, String::Number(i));
+  for (int i = 1; i <= 500; i += 2)
+    map.erase(i);
+  EXPECT_EQ(250u, map.size());
+  for (int i = 1; i <= 500; ++i)
+    EXPECT_EQ(i % 2 ? String() : String::Number(i), map.at(i));
+  EXPECT_GT(Arena().GetStats().arena_allocations, 0u);
+}
+
+TEST_F(LifecycleArenaTest, ChunksAreReusedAcrossScopes) {
+  size_t chunk_allocations = 0;
+  for (int round = 0; round < 3; ++round) {
+    {
+      LifecycleArena::Scope scope;
+      ArenaVector vector;
+      vector.Grow(100);
+    }
+    // The first chunk is kept for the next scope.
+    if (!round)
+      chunk_allocations = Arena().GetStats().chunk_allocations;
+    EXPECT_EQ(chunk_allocations, Arena().GetStats().chunk_allocations);
+  }
+  EXPECT_EQ(3u, Arena().GetStats().arena_allocations);
+}
+
+TEST_F(LifecycleArenaTest, NestedScopes) {
+  LifecycleArena::Scope outer_scope;
+  ArenaVector outer_vector;
+  outer_vector.push_back(1);
+  {
+    LifecycleArena::Scope inner_scope;
+    ArenaVector inner_vector;
+    inner_vector.push_back(2);
+    // Growing the outer vector in the inner scope is fine, since only the
+    // outermost scope releases memory.
+    outer_vector.Grow(1000);
+  }
+  EXPECT_EQ(1, outer_vector[0]);
+  EXPECT_TRUE(Arena().Contains(outer_vector.data()));
+}
+
+TEST_F(LifecycleArenaTest, BackingOutlivingScopeCrashes) {
+  auto outlive_scope = [] {
+    ArenaVector vector;
+    {
+      LifecycleArena::Scope scope;
+      vector.push_back(1);
+    }
+  };
+  EXPECT_DEATH_IF_SUPPORTED(outlive_scope(), "");
+}
+
+TEST_F(LifecycleArenaTest, LargeAllocations) {
+  LifecycleArena::Scope scope;
+  ArenaVector small;
+  small.push_back(1);
+  const int* small_data = small.data();
+  ArenaVector large;
+  large.Grow(LifecycleArena::kChunkSize);
+  EXPECT_TRUE(Arena().Contains(large.data()));
+  // The large vector has a chunk of its own, so the small one keeps growing
+  // in place.
+  small.Grow(32);
+  EXPECT_EQ(small_data, small.data());
+}
+
+}  // namespace
+
+}  // namespace WTF
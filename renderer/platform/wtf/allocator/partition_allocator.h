@@ -21,6 +21,7 @@ namespace WTF {
 class WTF_EXPORT PartitionAllocator {
  public:
   static constexpr bool kIsGarbageCollected = false;
+  static constexpr bool kCanExpandVectorBackingInPlace = false;
 
   template <typename T>
   static size_t MaxElementCountInBackingStore() {
@@ -32,6 +32,8 @@
 #include "testing/gtest/include/gtest/gtest.h"
 #include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
 #include "third_party/blink/renderer/platform/wtf/ref_counted.h"
+#include "third_party/blink/renderer/platform/wtf/text/string_hash.h"
+#include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
 #include "third_party/blink/renderer/platform/wtf/vector.h"
 #include "third_party/blink/renderer/platform/wtf/wtf_test_helper.h"
 
@@ -637,6 +639,35 @@ TEST(HashMapTest, IsValidKey) {
       (HashMap<scoped_refptr<DummyRefCounted>, int>::IsValidKey(nullptr)));
 }
 
+struct GroupProbingStringHashTraits : HashTraits<String> {
+  using ProbingPolicy = GroupProbing<>;
+};
+
+TEST(HashMapTest, GroupProbing) {
+  using Map = HashMap<String, int, DefaultHash<String>::Hash,
+                      GroupProbingStringHashTraits>;
+  constexpr int kCount = 500;
+  Map map;
+  for (int i = 0; i < kCount; ++i)
+    EXPECT_TRUE(map.insert(String::Number(i), i).is_new_entry);
+  for (int i = 0; i < kCount; i += 3)
+    map.erase(String::Number(i));
+  for (int i = 0; i < kCount; ++i) {
+    auto it = map.find(String::Number(i));
+    if (i % 3 == 0) {
+      EXPECT_EQ(map.end(), it) << i;
+    } else {
+      ASSERT_NE(map.end(), it) << i;
+      EXPECT_EQ(i, it->value);
+    }
+  }
+  // Reinsertion reuses deleted buckets.
+  for (int i = 0; i < kCount; i += 3)
+    EXPECT_TRUE(map.insert(String::Number(i), -i).is_new_entry);
+  EXPECT_EQ(static_cast<unsigned>(kCount), map.size());
+  EXPECT_EQ(-3, map.at(String::Number(3)));
+}
+
 static_assert(!IsTraceable<HashMap<int, int>>::value,
               "HashMap<int, int> must not be traceable.");
 
@@ -412,6 +412,50 @@ TEST(HashSetTest, HasTraitsForEnum) {
   set3.insert(std::make_pair(TestEnum::kItem0, TestEnumClass::kItem0));
 }
 
+struct GroupProbingIntHashTraits : HashTraits<int> {
+  using ProbingPolicy = GroupProbing<>;
+};
+
+// Maps keys to few distinct buckets, so that probe sequences cross groups.
+struct ClusteredIntHash {
+  static unsigned GetHash(int key) { return static_cast<unsigned>(key) % 3; }
+  static bool Equal(int a, int b) { return a == b; }
+  static const bool safe_to_compare_to_empty_or_deleted = true;
+};
+
+template <typename Set>
+void TestInsertEraseAndFind() {
+  constexpr int kCount = 1000;
+  Set set;
+  for (int i = 1; i <= kCount; ++i)
+    EXPECT_TRUE(set.insert(i).is_new_entry);
+  EXPECT_EQ(static_cast<unsigned>(kCount), set.size());
+
+  // Leave deleted buckets behind, then check that lookups probe past them.
+  for (int i = 1; i <= kCount; i += 2)
+    set.erase(i);
+  EXPECT_EQ(static_cast<unsigned>(kCount / 2), set.size());
+  for (int i = 1; i <= kCount; ++i)
+    EXPECT_EQ(i % 2 == 0, set.Contains(i)) << i;
+
+  for (int i = 1; i <= kCount; ++i)
+    EXPECT_EQ(i % 2 == 1, set.insert(i).is_new_entry) << i;
+  EXPECT_EQ(static_cast<unsigned>(kCount), set.size());
+  for (int i = 1; i <= kCount; ++i)
+    EXPECT_TRUE(set.Contains(i)) << i;
+  EXPECT_FALSE(set.Contains(kCount + 1));
+}
+
+TEST(HashSetTest, GroupProbing) {
+  TestInsertEraseAndFind<
+      HashSet<int, DefaultHash<int>::Hash, GroupProbingIntHashTraits>>();
+}
+
+TEST(HashSetTest, GroupProbingWithClusteredHash) {
+  TestInsertEraseAndFind<
+      HashSet<int, ClusteredIntHash, GroupProbingIntHashTraits>>();
+}
+
 static_assert(!IsTraceable<HashSet<int>>::value,
               "HashSet<int, int> must not be traceable.");
 
@@ -953,6 +953,9 @@ class HashTable final
   static const unsigned kMaxLoad = 2;
   static const unsigned kMinLoad = 6;
 
+  using ProbeSequence =
+      typename KeyTraits::ProbingPolicy::template Sequence<ValueType>;
+
   unsigned TableSizeMask() const {
     unsigned mask = table_size_ - 1;
     DCHECK_EQ((mask & table_size_), 0u);
@@ -1054,15 +1057,6 @@ inline HashTable<Key,
                 "off-heap collection.");
 }
 
-inline unsigned DoubleHash(unsigned key) {
-  key = ~key + (key >> 23);
-  key ^= (key << 12);
-  key ^= (key >> 7);
-  key ^= (key << 2);
-  key ^= (key >> 20);
-  return key;
-}
-
 inline unsigned CalculateCapacity(unsigned size) {
   for (unsigned mask = size; mask; mask >>= 1)
     size |= mask;         // 00110101010 -> 00111111111
@@ -1130,15 +1124,13 @@ HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, Allocator>::
   if (!table)
     return nullptr;
 
-  size_t k = 0;
-  size_t size_mask = TableSizeMask();
   unsigned h = HashTranslator::GetHash(key);
-  size_t i = h & size_mask;
+  ProbeSequence probe(h, TableSizeMask());
 
   UPDATE_ACCESS_COUNTS();
 
   while (1) {
-    const ValueType* entry = table + i;
+    const ValueType* entry = table + probe.Index();
 
     if (HashFunctions::safe_to_compare_to_empty_or_deleted) {
       if (HashTranslator::Equal(Extractor::Extract(*entry), key))
@@ -1155,9 +1147,7 @@ HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, Allocator>::
         return entry;
     }
     UPDATE_PROBE_COUNTS();
-    if (!k)
-      k = 1 | DoubleHash(h);
-    i = (i + k) & size_mask;
+    probe.Next();
   }
 }
 
@@ -1183,17 +1173,15 @@ HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, Allocator>::
   RegisterModification();
 
   ValueType* table = table_;
-  size_t k = 0;
-  size_t size_mask = TableSizeMask();
   unsigned h = HashTranslator::GetHash(key);
-  size_t i = h & size_mask;
+  ProbeSequence probe(h, TableSizeMask());
 
   UPDATE_ACCESS_COUNTS();
 
   ValueType* deleted_entry = nullptr;
 
   while (1) {
-    ValueType* entry = table + i;
+    ValueType* entry = table + probe.Index();
 
     if (IsEmptyBucket(*entry))
       return LookupType(deleted_entry ? deleted_entry : entry, false);
@@ -1211,9 +1199,7 @@ HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, Allocator>::
         return LookupType(entry, true);
     }
     UPDATE_PROBE_COUNTS();
-    if (!k)
-      k = 1 | DoubleHash(h);
-    i = (i + k) & size_mask;
+    probe.Next();
   }
 }
 
@@ -1239,17 +1225,15 @@ HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, Allocator>::
   RegisterModification();
 
   ValueType* table = table_;
-  size_t k = 0;
-  size_t size_mask = TableSizeMask();
   unsigned h = HashTranslator::GetHash(key);
-  size_t i = h & size_mask;
+  ProbeSequence probe(h, TableSizeMask());
 
   UPDATE_ACCESS_COUNTS();
 
   ValueType* deleted_entry = nullptr;
 
   while (1) {
-    ValueType* entry = table + i;
+    ValueType* entry = table + probe.Index();
 
     if (IsEmptyBucket(*entry))
       return MakeLookupResult(deleted_entry ? deleted_entry : entry, false, h);
@@ -1267,9 +1251,7 @@ HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, Allocator>::
         return MakeLookupResult(entry, true, h);
     }
     UPDATE_PROBE_COUNTS();
-    if (!k)
-      k = 1 | DoubleHash(h);
-    i = (i + k) & size_mask;
+    probe.Next();
   }
 }
 
@@ -1338,17 +1320,15 @@ HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, Allocator>::
   DCHECK(table_);
 
   ValueType* table = table_;
-  size_t k = 0;
-  size_t size_mask = TableSizeMask();
   unsigned h = HashTranslator::GetHash(key);
-  size_t i = h & size_mask;
+  ProbeSequence probe(h, TableSizeMask());
 
   UPDATE_ACCESS_COUNTS();
 
   ValueType* deleted_entry = nullptr;
   ValueType* entry;
   while (1) {
-    entry = table + i;
+    entry = table + probe.Index();
 
     if (IsEmptyBucket(*entry))
       break;
@@ -1366,9 +1346,7 @@ HashTable<Key, Value, Extractor, HashFunctions, Traits, KeyTraits, Allocator>::
         return AddResult(this, entry, false);
     }
     UPDATE_PROBE_COUNTS();
-    if (!k)
-      k = 1 | DoubleHash(h);
-    i = (i + k) & size_mask;
+    probe.Next();
   }
 
   RegisterModification();
@@ -0,0 +1,135 @@
+// Copyright 2020 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <memory>
+#include <string>
+
+#include "base/time/time.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+#include "third_party/blink/renderer/platform/wtf/hash_set.h"
+#include "third_party/blink/renderer/platform/wtf/text/string_hash.h"
+#include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
+
+namespace WTF {
+
+namespace {
+
+constexpr char kMetricPrefixHashTable[] = "HashTable.";
+constexpr char kMetricInsert[] = "insert";
+constexpr char kMetricLookupHit[] = "lookup_hit";
+constexpr char kMetricLookupMiss[] = "lookup_miss";
+constexpr char kMetricErase[] = "erase";
+
+constexpr wtf_size_t kNumKeys = 100000;
+constexpr int kNumLookupRounds = 10;
+
+template <typename T>
+struct GroupProbingHashTraits : HashTraits<T> {
+  using ProbingPolicy = GroupProbing<>;
+};
+
+perf_test::PerfResultReporter SetUpReporter(const std::string& story_name) {
+  perf_test::PerfResultReporter reporter(kMetricPrefixHashTable, story_name);
+  reporter.RegisterImportantMetric(kMetricInsert, "ns/op");
+  reporter.RegisterImportantMetric(kMetricLookupHit, "ns/op");
+  reporter.RegisterImportantMetric(kMetricLookupMiss, "ns/op");
+  reporter.RegisterImportantMetric(kMetricErase, "ns/op");
+  return reporter;
+}
+
+double NanosecondsPerOperation(base::TimeTicks start, size_t operations) {
+  return (base::TimeTicks::Now() - start).InNanosecondsF() / operations;
+}
+
+// Inserts |keys|, looks them and |missing_keys| up, and erases them again.
+template <typename Set, typename Key>
+void RunBenchmark(const std::string& story_name,
+                  const Vector<Key>& keys,
+                  const Vector<Key>& missing_keys) {
+  auto reporter = SetUpReporter(story_name);
+  Set set;
+
+  base::TimeTicks start = base::TimeTicks::Now();
+  for (const Key& key : keys)
+    set.insert(key);
+  reporter.AddResult(kMetricInsert,
+                     NanosecondsPerOperation(start, keys.size()));
+  EXPECT_EQ(keys.size(), set.size());
+
+  size_t found = 0;
+  start = base::TimeTicks::Now();
+  for (int round = 0; round < kNumLookupRounds; ++round) {
+    for (const Key& key : keys)
+      found += set.Contains(key);
+  }
+  reporter.AddResult(
+      kMetricLookupHit,
+      NanosecondsPerOperation(start, kNumLookupRounds * keys.size()));
+  EXPECT_EQ(kNumLookupRounds * keys.size(), found);
+
+  found = 0;
+  start = base::TimeTicks::Now();
+  for (int round = 0; round < kNumLookupRounds; ++round) {
+    for (const Key& key : missing_keys)
+      found += set.Contains(key);
+  }
+  reporter.AddResult(
+      kMetricLookupMiss,
+      NanosecondsPerOperation(start, kNumLookupRounds * missing_keys.size()));
+  EXPECT_EQ(0u, found);
+
+  start = base::TimeTicks::Now();
+  for (const Key& key : keys)
+    set.erase(key);
+  reporter.AddResult(kMetricErase, NanosecondsPerOperation(start, keys.size()));
+  EXPECT_TRUE(set.IsEmpty());
+}
+
+template <typename Key>
+void RunBenchmarks(const std::string& key_name,
+                   const Vector<Key>& keys,
+                   const Vector<Key>& missing_keys) {
+  using Hash = typename DefaultHash<Key>::Hash;
+  RunBenchmark<HashSet<Key, Hash, HashTraits<Key>>>(key_name + "_double_hash",
+                                                    keys, missing_keys);
+  RunBenchmark<HashSet<Key, Hash, GroupProbingHashTraits<Key>>>(
+      key_name + "_group", keys, missing_keys);
+}
+
+TEST(HashTablePerfTest, IntKeys) {
+  Vector<int> keys;
+  Vector<int> missing_keys;
+  for (wtf_size_t i = 1; i <= kNumKeys; ++i) {
+    keys.push_back(i);
+    missing_keys.push_back(-static_cast<int>(i) - 1);
+  }
+  RunBenchmarks("int", keys, missing_keys);
+}
+
+TEST(HashTablePerfTest, PointerKeys) {
+  Vector<std::unique_ptr<int>> objects;
+  Vector<int*> keys;
+  Vector<int*> missing_keys;
+  for (wtf_size_t i = 0; i < 2 * kNumKeys; ++i) {
+    objects.push_back(std::make_unique<int>(i));
+    (i % 2 ? missing_keys : keys).push_back(objects.back().get());
+  }
+  RunBenchmarks("pointer", keys, missing_keys);
+}
+
+TEST(HashTablePerfTest, StringKeys) {
+  Vector<String> keys;
+  Vector<String> missing_keys;
+  for (wtf_size_t i = 0; i < kNumKeys; ++i) {
+    keys.push_back(String::Format("key-%u", i));
+    missing_keys.push_back(String::Format("missing-%u", i));
+  }
+  RunBenchmarks("string", keys, missing_keys);
+}
+
+}  // namespace
+
+}  // namespace WTF
@@ -0,0 +1,135 @@
+// Copyright 2020 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef THIRD_PARTY_BLINK_RENDERER_PLATFORM_WTF_HASH_TABLE_PROBING_H_
+#define THIRD_PARTY_BLINK_RENDERER_PLATFORM_WTF_HASH_TABLE_PROBING_H_
+
+#include <stddef.h>
+
+#include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
+
+namespace WTF {
+
+// Probing policies decide the order in which HashTable visits its buckets
+// when looking up a key. A policy is selected per instantiation through the
+// ProbingPolicy member of the key traits, e.g.
+//
+//   struct MyTraits : HashTraits<int> {
+//     using ProbingPolicy = GroupProbing<>;
+//   };
+//   HashSet<int, DefaultHash<int>::Hash, MyTraits> set;
+//
+// A policy provides a Sequence class template, instantiated with the bucket
+// type. A sequence starts at the bucket that |hash| maps to and must visit
+// every bucket of the table before repeating one, since lookups only stop at
+// a matching or an empty bucket. Policies only change the probing order, not
+// the bucket layout, so backings stay compatible with Oilpan tracing, weak
+// processing and compaction.
+
+inline unsigned DoubleHash(unsigned key) {
+  key = ~key + (key >> 23);
+  key ^= (key << 12);
+  key ^= (key >> 7);
+  key ^= (key << 2);
+  key ^= (key >> 20);
+  return key;
+}
+
+// The default policy. The step between probes is derived from a second hash,
+// so keys that collide on their first bucket follow different sequences. This
+// is robust against weak hash functions but touches a new cache line on almost
+// every probe.
+struct DoubleHashProbing {
+  STATIC_ONLY(DoubleHashProbing);
+
+  template <typename Value>
+  class Sequence {
+    STACK_ALLOCATED();
+
+   public:
+    Sequence(unsigned hash, size_t size_mask)
+        : hash_(hash), size_mask_(size_mask), index_(hash & size_mask) {}
+
+    size_t Index() const { return index_; }
+
+    void Next() {
+      // The step is odd, so it visits every bucket of a power-of-two table.
+      if (!step_)
+        step_ = 1 | DoubleHash(hash_);
+      index_ = (index_ + step_) & size_mask_;
+    }
+
+   private:
+    const unsigned hash_;
+    const size_t size_mask_;
+    size_t index_;
+    size_t step_ = 0;
+  };
+};
+
+namespace internal {
+
+constexpr size_t FloorToPowerOfTwo(size_t n) {
+  return n <= 1 ? 1 : 2 * FloorToPowerOfTwo(n / 2);
+}
+
+}  // namespace internal
+
+// Splits the table into aligned groups of buckets that fit in |kGroupBytes|
+// and scans the group of the first bucket linearly, wrapping around within
+// the group, before moving to other groups. Groups are visited in triangular
+// order, which covers all of them because their number is a power of two.
+//
+// Most lookups then touch a single cache line, which makes this policy faster
+// than DoubleHashProbing for small buckets and hash functions that spread
+// keys well over the low bits. Keys that collide on a bucket also share its
+// group, so a hash function with clustered low bits makes it slower.
+template <size_t kGroupBytes = 64>
+struct GroupProbing {
+  STATIC_ONLY(GroupProbing);
+
+  template <typename Value>
+  class Sequence {
+    STACK_ALLOCATED();
+
+   public:
+    Sequence(unsigned hash, size_t size_mask)
+        : size_mask_(size_mask),
+          group_mask_(size_mask < kBucketsPerGroup ? size_mask
+                                                   : kBucketsPerGroup - 1),
+          group_(hash & size_mask & ~group_mask_),
+          offset_(hash & group_mask_) {}
+
+    size_t Index() const {
+      return group_ + ((offset_ + probe_in_group_) & group_mask_);
+    }
+
+    void Next() {
+      if (probe_in_group_ < group_mask_) {
+        ++probe_in_group_;
+        return;
+      }
+      probe_in_group_ = 0;
+      group_ = (group_ + ++group_step_ * (group_mask_ + 1)) & size_mask_;
+    }
+
+   private:
+    static constexpr size_t kBucketsPerGroup =
+        internal::FloorToPowerOfTwo(kGroupBytes / sizeof(Value));
+
+    const size_t size_mask_;
+    const size_t group_mask_;
+    size_t group_;
+    const size_t offset_;
+    size_t probe_in_group_ = 0;
+    size_t group_step_ = 0;
+  };
+};
+
+}  // namespace WTF
+
+using WTF::DoubleHashProbing;
+using WTF::GroupProbing;
+
+#endif  // THIRD_PARTY_BLINK_RENDERER_PLATFORM_WTF_HASH_TABLE_PROBING_H_
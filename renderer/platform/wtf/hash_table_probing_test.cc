@@ -0,0 +1,65 @@
+// Copyright 2020 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/platform/wtf/hash_table_probing.h"
+
+#include <utility>
+
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
+
+namespace WTF {
+
+namespace {
+
+struct LargeBucket {
+  char data[200];
+};
+
+// Checks that the sequence visits every bucket exactly once before repeating.
+template <typename Policy, typename Value>
+void ExpectVisitsAllBuckets(size_t table_size) {
+  for (unsigned hash : {0u, 1u, 7u, 0x9e3779b9u, 0xffffffffu}) {
+    Vector<bool> visited(static_cast<wtf_size_t>(table_size));
+    typename Policy::template Sequence<Value> probe(hash, table_size - 1);
+    EXPECT_EQ(hash & (table_size - 1), probe.Index());
+    for (size_t i = 0; i < table_size; ++i, probe.Next()) {
+      ASSERT_LT(probe.Index(), table_size);
+      EXPECT_FALSE(visited[static_cast<wtf_size_t>(probe.Index())]);
+      visited[static_cast<wtf_size_t>(probe.Index())] = true;
+    }
+  }
+}
+
+template <typename Policy>
+void ExpectVisitsAllBuckets() {
+  for (size_t table_size = 1; table_size <= 1024; table_size *= 2) {
+    ExpectVisitsAllBuckets<Policy, int>(table_size);
+    ExpectVisitsAllBuckets<Policy, std::pair<void*, void*>>(table_size);
+    ExpectVisitsAllBuckets<Policy, LargeBucket>(table_size);
+  }
+}
+
+TEST(HashTableProbingTest, DoubleHashVisitsAllBuckets) {
+  ExpectVisitsAllBuckets<DoubleHashProbing>();
+}
+
+TEST(HashTableProbingTest, GroupVisitsAllBuckets) {
+  ExpectVisitsAllBuckets<GroupProbing<>>();
+  ExpectVisitsAllBuckets<GroupProbing<16>>();
+}
+
+TEST(HashTableProbingTest, GroupScansItsGroupFirst) {
+  // 16 ints fit in a 64 byte group.
+  constexpr size_t kTableSize = 256;
+  constexpr unsigned kHash = 0x35;
+  GroupProbing<>::Sequence<int> probe(kHash, kTableSize - 1);
+  for (size_t i = 0; i < 16; ++i, probe.Next())
+    EXPECT_EQ(0x30u, probe.Index() & ~size_t{15});
+  EXPECT_NE(0x30u, probe.Index() & ~size_t{15});
+}
+
+}  // namespace
+
+}  // namespace WTF
@@ -30,6 +30,7 @@
 #include "third_party/blink/renderer/platform/wtf/forward.h"
 #include "third_party/blink/renderer/platform/wtf/hash_functions.h"
 #include "third_party/blink/renderer/platform/wtf/hash_table_deleted_value_type.h"
+#include "third_party/blink/renderer/platform/wtf/hash_table_probing.h"
 #include "third_party/blink/renderer/platform/wtf/std_lib_extras.h"
 #include "third_party/blink/renderer/platform/wtf/type_traits.h"
 
@@ -76,6 +77,9 @@ struct GenericHashTraitsBase<false, T> {
   static const unsigned kMinimumTableSize = 8;
 #endif
 
+  // The order in which buckets are probed. See hash_table_probing.h.
+  using ProbingPolicy = DoubleHashProbing;
+
   // When a hash table backing store is traced, its elements will be
   // traced if their class type has a trace method. However, weak-referenced
   // elements should not be traced then, but handled by the weak processing
@@ -379,6 +383,7 @@ struct PairHashTraits
   }
 
   static const unsigned kMinimumTableSize = FirstTraits::kMinimumTableSize;
+  using ProbingPolicy = typename FirstTraits::ProbingPolicy;
 
   static void ConstructDeletedValue(TraitType& slot, bool zero_value) {
     FirstTraits::ConstructDeletedValue(slot.first, zero_value);
@@ -459,6 +464,7 @@ struct KeyValuePairHashTraits
   };
 
   static const unsigned kMinimumTableSize = KeyTraits::kMinimumTableSize;
+  using ProbingPolicy = typename KeyTraits::ProbingPolicy;
 
   static void ConstructDeletedValue(TraitType& slot, bool zero_value) {
     KeyTraits::ConstructDeletedValue(slot.key, zero_value);
@@ -138,8 +138,9 @@ void SharedBuffer::AppendInternal(const char* data, size_t length) {
   size_t position_in_segment = OffsetInSegment(size_ - buffer_.size());
   size_ += length;
 
-  if (size_ <= kSegmentSize) {
-    // No need to use segments for small resource data.
+  if (size_ <= std::max<size_t>(kSegmentSize, reserved_capacity_)) {
+    // No need to use segments for small resource data, or for data that fits
+    // in the reserved capacity.
     buffer_.Append(data, static_cast<wtf_size_t>(length));
     return;
   }
@@ -157,10 +158,17 @@ void SharedBuffer::AppendInternal(const char* data, size_t length) {
   }
 }
 
+void SharedBuffer::ReserveCapacity(size_t capacity) {
+  DCHECK(IsEmpty());
+  buffer_.ReserveCapacity(SafeCast<wtf_size_t>(capacity));
+  reserved_capacity_ = capacity;
+}
+
 void SharedBuffer::Clear() {
   segments_.clear();
   size_ = 0;
   buffer_.clear();
+  reserved_capacity_ = 0;
 }
 
 SharedBuffer::Iterator SharedBuffer::begin() const {
@@ -174,6 +182,7 @@ SharedBuffer::Iterator SharedBuffer::end() const {
 void SharedBuffer::MergeSegmentsIntoBuffer() {
   wtf_size_t bytes_left =
       base::checked_cast<wtf_size_t>(size_ - buffer_.size());
+  flattened_size_ += bytes_left;
   for (const auto& segment : segments_) {
     wtf_size_t bytes_to_copy = std::min<wtf_size_t>(bytes_left, kSegmentSize);
     buffer_.Append(segment.get(), bytes_to_copy);
@@ -229,6 +238,7 @@ SharedBuffer::DeprecatedFlatData::DeprecatedFlatData(
   }
 
   // Merge all segments.
+  buffer_->flattened_size_ += buffer_->size();
   flat_buffer_.ReserveInitialCapacity(SafeCast<wtf_size_t>(buffer_->size()));
   for (const auto& span : *buffer_)
     flat_buffer_.Append(span.data(), static_cast<wtf_size_t>(span.size()));
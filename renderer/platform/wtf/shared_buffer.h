@@ -141,6 +141,12 @@ class WTF_EXPORT SharedBuffer : public RefCounted<SharedBuffer> {
   }
   void Append(const Vector<char>& data) { Append(data.data(), data.size()); }
 
+  // Makes the data that will be appended to an empty SharedBuffer stay
+  // contiguous up to |capacity| bytes, instead of being split in segments
+  // after kSegmentSize bytes, so that Data() and DeprecatedFlatData don't need
+  // to copy it.
+  void ReserveCapacity(size_t capacity);
+
   void Clear();
 
   Iterator begin() const;
@@ -174,6 +180,10 @@ class WTF_EXPORT SharedBuffer : public RefCounted<SharedBuffer> {
 
   void GetMemoryDumpNameAndSize(String& dump_name, size_t& dump_size) const;
 
+  // The number of bytes copied so far by Data() and DeprecatedFlatData to merge
+  // segments into a contiguous buffer.
+  size_t FlattenedSize() const { return flattened_size_; }
+
   // Helper for providing a contiguous view of the data.  If the SharedBuffer is
   // segmented, this will copy/merge all segments into a temporary buffer.
   // In general, clients should use the efficient/segmented accessors.
@@ -216,6 +226,8 @@ class WTF_EXPORT SharedBuffer : public RefCounted<SharedBuffer> {
   size_t size_;
   Vector<char> buffer_;
   Vector<Segment> segments_;
+  size_t reserved_capacity_ = 0;
+  mutable size_t flattened_size_ = 0;
 };
 
 // Current CopyAs specializations.
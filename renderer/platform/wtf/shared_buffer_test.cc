@@ -200,6 +200,50 @@ TEST(SharedBufferTest, FlatData) {
   }
 }
 
+TEST(SharedBufferTest, ReserveCapacity) {
+  Vector<char> data(SharedBuffer::kSegmentSize * 3);
+  std::generate(data.begin(), data.end(), &std::rand);
+  scoped_refptr<SharedBuffer> shared_buffer = SharedBuffer::Create();
+  shared_buffer->ReserveCapacity(data.size());
+  for (wtf_size_t offset = 0; offset < data.size(); offset += 1000) {
+    shared_buffer->Append(data.data() + offset,
+                          std::min<size_t>(1000, data.size() - offset));
+  }
+
+  // The data is not segmented, so it doesn't need to be copied to be flat.
+  EXPECT_EQ(++shared_buffer->begin(), shared_buffer->end());
+  const SharedBuffer::DeprecatedFlatData flat_buffer(shared_buffer);
+  EXPECT_EQ(shared_buffer->begin()->data(), flat_buffer.Data());
+  EXPECT_EQ(0, memcmp(data.data(), flat_buffer.Data(), data.size()));
+  EXPECT_EQ(0u, shared_buffer->FlattenedSize());
+
+  // Data beyond the reserved capacity goes to segments.
+  shared_buffer->Append(data.data(), 10u);
+  EXPECT_EQ(data.size() + 10, shared_buffer->size());
+  EXPECT_NE(++shared_buffer->begin(), shared_buffer->end());
+  Vector<char> copy = shared_buffer->CopyAs<Vector<char>>();
+  EXPECT_EQ(0, memcmp(data.data(), copy.data(), data.size()));
+  EXPECT_EQ(0, memcmp(data.data(), copy.data() + data.size(), 10u));
+}
+
+TEST(SharedBufferTest, FlattenedSize) {
+  Vector<char> data(SharedBuffer::kSegmentSize * 2);
+  scoped_refptr<SharedBuffer> shared_buffer = SharedBuffer::Create();
+  shared_buffer->Append(data);
+  EXPECT_EQ(0u, shared_buffer->FlattenedSize());
+
+  {
+    const SharedBuffer::DeprecatedFlatData flat_buffer(shared_buffer);
+  }
+  EXPECT_EQ(data.size(), shared_buffer->FlattenedSize());
+
+  shared_buffer->Data();
+  EXPECT_EQ(2 * data.size(), shared_buffer->FlattenedSize());
+  // The data is flat now.
+  shared_buffer->Data();
+  EXPECT_EQ(2 * data.size(), shared_buffer->FlattenedSize());
+}
+
 TEST(SharedBufferTest, GetIteratorAt) {
   Vector<char> data(SharedBuffer::kSegmentSize + 256);
   std::generate(data.begin(), data.end(), &std::rand);
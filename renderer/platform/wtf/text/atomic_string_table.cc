@@ -4,12 +4,16 @@
 
 #include "third_party/blink/renderer/platform/wtf/text/atomic_string_table.h"
 
+#include "third_party/blink/renderer/platform/wtf/text/shared_atomic_string_table.h"
 #include "third_party/blink/renderer/platform/wtf/text/string_hash.h"
 #include "third_party/blink/renderer/platform/wtf/text/utf8.h"
 
 namespace WTF {
 
 AtomicStringTable::AtomicStringTable() {
+  // Static strings are found in the shared table when it is enabled.
+  if (SharedAtomicStringTable::IsEnabled())
+    return;
   for (StringImpl* string : StringImpl::AllStaticStrings().Values())
     Add(string);
 }
@@ -29,6 +33,14 @@ void AtomicStringTable::ReserveCapacity(unsigned size) {
 
 template <typename T, typename HashTranslator>
 scoped_refptr<StringImpl> AtomicStringTable::AddToStringTable(const T& value) {
+  if (SharedAtomicStringTable::IsEnabled()) {
+    if (StringImpl* shared =
+            SharedAtomicStringTable::Instance().Find<HashTranslator>(
+                value, HashTranslator::GetHash(value))) {
+      return shared;
+    }
+  }
+
   HashSet<StringImpl*>::AddResult add_result =
       table_.AddWithTranslator<HashTranslator>(value);
 
@@ -42,13 +54,14 @@ template <typename CharacterType>
 struct HashTranslatorCharBuffer {
   const CharacterType* s;
   unsigned length;
+  // Computed once, so that the shared and the per-thread table do not hash the
+  // characters twice.
+  unsigned hash;
 };
 
 typedef HashTranslatorCharBuffer<UChar> UCharBuffer;
 struct UCharBufferTranslator {
-  static unsigned GetHash(const UCharBuffer& buf) {
-    return StringHasher::ComputeHashAndMaskTop8Bits(buf.s, buf.length);
-  }
+  static unsigned GetHash(const UCharBuffer& buf) { return buf.hash; }
 
   static bool Equal(StringImpl* const& str, const UCharBuffer& buf) {
     return WTF::Equal(str, buf.s, buf.length);
@@ -98,27 +111,17 @@ struct HashAndUTF8CharactersTranslator {
           buffer.characters + buffer.length);
     }
 
-    if (string->Is8Bit()) {
-      const LChar* string_characters = string->Characters8();
-
-      for (unsigned i = 0; i < buffer.length; ++i) {
-        DCHECK(IsASCII(buffer.characters[i]));
-        if (string_characters[i] != buffer.characters[i])
-          return false;
-      }
-
-      return true;
-    }
-
-    const UChar* string_characters = string->Characters16();
-
-    for (unsigned i = 0; i < buffer.length; ++i) {
+#if DCHECK_IS_ON()
+    for (unsigned i = 0; i < buffer.length; ++i)
       DCHECK(IsASCII(buffer.characters[i]));
-      if (string_characters[i] != buffer.characters[i])
-        return false;
-    }
-
-    return true;
+#endif
+    const LChar* buffer_characters =
+        reinterpret_cast<const LChar*>(buffer.characters);
+    if (string->Is8Bit())
+      return WTF::Equal(string->Characters8(), buffer_characters,
+                        buffer.length);
+    return WTF::Equal(buffer_characters, string->Characters16(),
+                      buffer.length);
   }
 
   static void Translate(StringImpl*& location,
@@ -155,15 +158,14 @@ scoped_refptr<StringImpl> AtomicStringTable::Add(const UChar* s,
   if (!length)
     return StringImpl::empty_;
 
-  UCharBuffer buffer = {s, length};
+  UCharBuffer buffer = {s, length,
+                        StringHasher::ComputeHashAndMaskTop8Bits(s, length)};
   return AddToStringTable<UCharBuffer, UCharBufferTranslator>(buffer);
 }
 
 typedef HashTranslatorCharBuffer<LChar> LCharBuffer;
 struct LCharBufferTranslator {
-  static unsigned GetHash(const LCharBuffer& buf) {
-    return StringHasher::ComputeHashAndMaskTop8Bits(buf.s, buf.length);
-  }
+  static unsigned GetHash(const LCharBuffer& buf) { return buf.hash; }
 
   static bool Equal(StringImpl* const& str, const LCharBuffer& buf) {
     return WTF::Equal(str, buf.s, buf.length);
@@ -188,7 +190,8 @@ scoped_refptr<StringImpl> AtomicStringTable::Add(const LChar* s,
   if (!length)
     return StringImpl::empty_;
 
-  LCharBuffer buffer = {s, length};
+  LCharBuffer buffer = {s, length,
+                        StringHasher::ComputeHashAndMaskTop8Bits(s, length)};
   return AddToStringTable<LCharBuffer, LCharBufferTranslator>(buffer);
 }
 
@@ -196,6 +199,11 @@ StringImpl* AtomicStringTable::Add(StringImpl* string) {
   if (!string->length())
     return StringImpl::empty_;
 
+  if (SharedAtomicStringTable::IsEnabled()) {
+    if (StringImpl* shared = SharedAtomicStringTable::Instance().Find(string))
+      return shared;
+  }
+
   StringImpl* result = *table_.insert(string).stored_value;
 
   if (!result->IsAtomic())
@@ -16,7 +16,8 @@
 namespace WTF {
 
 // The underlying storage that keeps the map of unique AtomicStrings. This is
-// not thread safe and each Threading has one.
+// not thread safe and each Threading has one. When SharedAtomicStringTable is
+// enabled, it is consulted first and static strings are only stored there.
 class WTF_EXPORT AtomicStringTable final {
   USING_FAST_MALLOC(AtomicStringTable);
 
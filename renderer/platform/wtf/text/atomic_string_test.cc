@@ -30,7 +30,12 @@
 
 #include "third_party/blink/renderer/platform/wtf/text/atomic_string.h"
 
+#include <string>
+
+#include "base/time/time.h"
 #include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
 
 namespace WTF {
 
@@ -75,4 +80,88 @@ TEST(AtomicStringTest, ImplEquality) {
   EXPECT_NE(bar.Impl(), baz.Impl());
 }
 
+TEST(AtomicStringTest, LookupAcrossCharacterWidths) {
+  // Lengths around the vectorized comparison threshold, so that table lookups
+  // from 16-bit and UTF-8 input go through both the vector loop and its tail.
+  for (wtf_size_t length : {1u, 15u, 16u, 17u, 33u, 100u}) {
+    std::string ascii;
+    Vector<UChar> utf16;
+    for (wtf_size_t i = 0; i < length; ++i) {
+      ascii.push_back('a' + i % 26);
+      utf16.push_back(ascii.back());
+    }
+    AtomicString atom(ascii.c_str());
+    ASSERT_TRUE(atom.Impl()->Is8Bit());
+    EXPECT_EQ(atom.Impl(), AtomicString(utf16.data(), length).Impl());
+    EXPECT_EQ(atom.Impl(),
+              AtomicString::FromUTF8(ascii.data(), ascii.size()).Impl());
+
+    utf16.back() = 0x100;
+    AtomicString wide(utf16.data(), length);
+    EXPECT_NE(atom.Impl(), wide.Impl());
+    EXPECT_FALSE(wide.Impl()->Is8Bit());
+  }
+}
+
+namespace {
+
+constexpr char kMetricPrefixAtomicString[] = "AtomicString.";
+constexpr size_t kBenchmarkKeys = 1000;
+constexpr size_t kBenchmarkRounds = 100;
+
+// Atomizes |kBenchmarkKeys| distinct strings of |length| characters once, then
+// looks each of them up again |kBenchmarkRounds| times from 8-bit, 16-bit and
+// UTF-8 buffers. Lookups hash the buffer and compare it against the existing
+// table entry, which is what the parser does for every tag and attribute name.
+void RunLookupBenchmark(wtf_size_t length) {
+  Vector<std::string> keys;
+  Vector<AtomicString> atoms;
+  for (size_t i = 0; i < kBenchmarkKeys; ++i) {
+    std::string key = std::to_string(i);
+    while (key.size() < length)
+      key.push_back('a' + key.size() % 26);
+    keys.push_back(key);
+    atoms.push_back(AtomicString(key.c_str()));
+  }
+  Vector<Vector<UChar>> wide_keys(kBenchmarkKeys);
+  for (size_t i = 0; i < kBenchmarkKeys; ++i)
+    wide_keys[i].AppendRange(keys[i].begin(), keys[i].end());
+
+  perf_test::PerfResultReporter reporter(kMetricPrefixAtomicString,
+                                         "length_" + std::to_string(length));
+  auto run = [&](const char* metric, auto lookup) {
+    reporter.RegisterImportantMetric(metric, "runs/s");
+    size_t mismatches = 0;
+    const base::TimeTicks start = base::TimeTicks::Now();
+    for (size_t round = 0; round < kBenchmarkRounds; ++round) {
+      for (size_t i = 0; i < kBenchmarkKeys; ++i)
+        mismatches += atoms[i].Impl() != lookup(i).Impl();
+    }
+    const base::TimeDelta duration = base::TimeTicks::Now() - start;
+    EXPECT_EQ(0u, mismatches);
+    reporter.AddResult(metric, kBenchmarkRounds * kBenchmarkKeys /
+                                   duration.InSecondsF());
+  };
+  run("8bit_lookups", [&](size_t i) {
+    return AtomicString(reinterpret_cast<const LChar*>(keys[i].data()),
+                        keys[i].size());
+  });
+  run("16bit_lookups", [&](size_t i) {
+    return AtomicString(wide_keys[i].data(), wide_keys[i].size());
+  });
+  run("utf8_lookups", [&](size_t i) {
+    return AtomicString::FromUTF8(keys[i].data(), keys[i].size());
+  });
+}
+
+}  // namespace
+
+TEST(AtomicStringTest, LookupPerformanceShortKeys) {
+  RunLookupBenchmark(8);
+}
+
+TEST(AtomicStringTest, LookupPerformanceLongKeys) {
+  RunLookupBenchmark(128);
+}
+
 }  // namespace WTF
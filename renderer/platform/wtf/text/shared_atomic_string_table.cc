@@ -0,0 +1,121 @@
+// Copyright 2020 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/platform/wtf/text/shared_atomic_string_table.h"
+
+#include "third_party/blink/renderer/platform/wtf/std_lib_extras.h"
+#include "third_party/blink/renderer/platform/wtf/wtf.h"
+
+namespace WTF {
+
+namespace {
+
+struct StringImplTranslator {
+  static bool Equal(StringImpl* const& entry, const StringImpl* string) {
+    return EqualNonNull(entry, string);
+  }
+};
+
+}  // namespace
+
+std::atomic_bool SharedAtomicStringTable::enabled_{false};
+
+SharedAtomicStringTable::Slots::Slots(wtf_size_t capacity)
+    : capacity(capacity), entries(new std::atomic<StringImpl*>[capacity]) {
+  DCHECK(!(capacity & (capacity - 1)));
+  for (wtf_size_t i = 0; i < capacity; ++i)
+    entries[i].store(nullptr, std::memory_order_relaxed);
+}
+
+SharedAtomicStringTable::SharedAtomicStringTable() = default;
+
+SharedAtomicStringTable::~SharedAtomicStringTable() = default;
+
+// static
+SharedAtomicStringTable& SharedAtomicStringTable::Instance() {
+  DEFINE_THREAD_SAFE_STATIC_LOCAL(SharedAtomicStringTable, table, ());
+  return table;
+}
+
+// static
+void SharedAtomicStringTable::Enable() {
+  DCHECK(IsMainThread());
+  SharedAtomicStringTable& table = Instance();
+  for (StringImpl* string : StringImpl::AllStaticStrings().Values()) {
+    // Mark the string atomic here, on the main thread, so that other threads
+    // never write to it.
+    string->SetIsAtomic(true);
+    table.Add(string);
+  }
+  enabled_.store(true, std::memory_order_release);
+}
+
+StringImpl* SharedAtomicStringTable::Add(StringImpl* static_string) {
+  DCHECK(static_string->IsStatic());
+  DCHECK(static_string->length());
+  const unsigned hash = static_string->ExistingHash();
+  Shard& shard = ShardFor(hash);
+  MutexLocker locker(shard.mutex);
+  Slots* slots = shard.slots.load(std::memory_order_relaxed);
+  if (!slots || (shard.size + 1) * 2 > slots->capacity) {
+    Grow(shard);
+    slots = shard.slots.load(std::memory_order_relaxed);
+  }
+
+  const wtf_size_t mask = slots->capacity - 1;
+  wtf_size_t index = FirstProbe(hash, slots->capacity);
+  for (wtf_size_t probe = 1;; index = (index + probe++) & mask) {
+    StringImpl* entry = slots->entries[index].load(std::memory_order_relaxed);
+    if (!entry)
+      break;
+    if (entry->ExistingHash() == hash && EqualNonNull(entry, static_string))
+      return entry;
+  }
+  // Publish the string; lookups on other threads acquire the slot.
+  slots->entries[index].store(static_string, std::memory_order_release);
+  ++shard.size;
+  return static_string;
+}
+
+StringImpl* SharedAtomicStringTable::Find(const StringImpl* string) const {
+  if (!string->length())
+    return nullptr;
+  return Find<StringImplTranslator>(string, string->GetHash());
+}
+
+wtf_size_t SharedAtomicStringTable::size() const {
+  wtf_size_t size = 0;
+  for (const Shard& shard : shards_) {
+    MutexLocker locker(shard.mutex);
+    size += shard.size;
+  }
+  return size;
+}
+
+void SharedAtomicStringTable::Grow(Shard& shard) {
+  const Slots* old_slots = shard.slots.load(std::memory_order_relaxed);
+  const wtf_size_t capacity =
+      old_slots ? old_slots->capacity * 2 : kMinimumShardCapacity;
+  auto new_slots = std::make_unique<Slots>(capacity);
+  if (old_slots) {
+    const wtf_size_t mask = capacity - 1;
+    for (wtf_size_t i = 0; i < old_slots->capacity; ++i) {
+      StringImpl* entry =
+          old_slots->entries[i].load(std::memory_order_relaxed);
+      if (!entry)
+        continue;
+      wtf_size_t index = FirstProbe(entry->ExistingHash(), capacity);
+      wtf_size_t probe = 1;
+      while (new_slots->entries[index].load(std::memory_order_relaxed))
+        index = (index + probe++) & mask;
+      new_slots->entries[index].store(entry, std::memory_order_relaxed);
+    }
+  }
+  // The release store makes the copied entries visible to lookups. The old
+  // array stays in |all_slots| because lookups may still be reading it.
+  shard.slots.store(new_slots.get(), std::memory_order_release);
+  shard.all_slots.push_back(std::move(new_slots));
+}
+
+}  // namespace WTF
@@ -0,0 +1,130 @@
+// Copyright 2020 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef THIRD_PARTY_BLINK_RENDERER_PLATFORM_WTF_TEXT_SHARED_ATOMIC_STRING_TABLE_H_
+#define THIRD_PARTY_BLINK_RENDERER_PLATFORM_WTF_TEXT_SHARED_ATOMIC_STRING_TABLE_H_
+
+#include <atomic>
+#include <memory>
+
+#include "base/macros.h"
+#include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
+#include "third_party/blink/renderer/platform/wtf/text/string_impl.h"
+#include "third_party/blink/renderer/platform/wtf/threading_primitives.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
+#include "third_party/blink/renderer/platform/wtf/wtf_export.h"
+
+namespace WTF {
+
+// A process-wide table of atomic strings that is consulted by the
+// AtomicStringTable of every thread before its own storage. It only holds
+// static strings: those are immutable, not reference counted and never
+// destroyed, so they can be shared between threads without making reference
+// counting atomic. With the table enabled, worker and worklet threads no longer
+// copy all static strings into their own AtomicStringTable, and AtomicStrings
+// backed by static strings can be passed between threads.
+//
+// The table is sharded by hash. Lookups do not take locks: each shard is an
+// insert-only open-addressing array of atomic slots that is published with
+// release stores. Insertions take the lock of their shard. Growing a shard
+// publishes a new array and keeps the old one alive, so concurrent lookups
+// never observe freed memory.
+class WTF_EXPORT SharedAtomicStringTable final {
+  USING_FAST_MALLOC(SharedAtomicStringTable);
+
+ public:
+  SharedAtomicStringTable();
+  ~SharedAtomicStringTable();
+
+  // The process-wide instance.
+  static SharedAtomicStringTable& Instance();
+
+  // Whether AtomicStringTables consult Instance(). Cheap enough to be checked
+  // on every atomization.
+  static bool IsEnabled() { return enabled_.load(std::memory_order_acquire); }
+
+  // Adds all static strings to Instance() and enables it. Must be called on
+  // the main thread once all static strings have been created, i.e. right
+  // before StringImpl::FreezeStaticStrings().
+  static void Enable();
+
+  // Adds a static string. Returns the existing entry if the table already
+  // holds a string with the same contents.
+  StringImpl* Add(StringImpl* static_string);
+
+  // Looks up a string using the same translators as AtomicStringTable.
+  // |hash| must be the value HashTranslator::GetHash() returns for |value|.
+  template <typename HashTranslator, typename T>
+  StringImpl* Find(const T& value, unsigned hash) const;
+
+  StringImpl* Find(const StringImpl* string) const;
+
+  wtf_size_t size() const;
+
+ private:
+  static constexpr unsigned kShardBits = 4;
+  static constexpr wtf_size_t kShardCount = 1u << kShardBits;
+  static constexpr wtf_size_t kMinimumShardCapacity = 64;
+
+  struct Slots {
+    USING_FAST_MALLOC(Slots);
+
+   public:
+    explicit Slots(wtf_size_t capacity);
+
+    const wtf_size_t capacity;
+    std::unique_ptr<std::atomic<StringImpl*>[]> entries;
+  };
+
+  struct Shard {
+    DISALLOW_NEW();
+
+   public:
+    std::atomic<Slots*> slots{nullptr};
+    // The remaining members are guarded by |mutex|.
+    mutable Mutex mutex;
+    wtf_size_t size = 0;
+    Vector<std::unique_ptr<Slots>> all_slots;
+  };
+
+  Shard& ShardFor(unsigned hash) { return shards_[hash & (kShardCount - 1)]; }
+  const Shard& ShardFor(unsigned hash) const {
+    return shards_[hash & (kShardCount - 1)];
+  }
+  static wtf_size_t FirstProbe(unsigned hash, wtf_size_t capacity) {
+    return (hash >> kShardBits) & (capacity - 1);
+  }
+
+  void Grow(Shard&);
+
+  static std::atomic_bool enabled_;
+
+  Shard shards_[kShardCount];
+
+  DISALLOW_COPY_AND_ASSIGN(SharedAtomicStringTable);
+};
+
+template <typename HashTranslator, typename T>
+StringImpl* SharedAtomicStringTable::Find(const T& value, unsigned hash) const {
+  const Slots* slots = ShardFor(hash).slots.load(std::memory_order_acquire);
+  if (!slots)
+    return nullptr;
+  // Triangular probing visits every slot of a power-of-two sized array, and
+  // shards are never more than half full, so the loop ends at an empty slot.
+  const wtf_size_t mask = slots->capacity - 1;
+  wtf_size_t index = FirstProbe(hash, slots->capacity);
+  for (wtf_size_t probe = 1;; index = (index + probe++) & mask) {
+    StringImpl* entry = slots->entries[index].load(std::memory_order_acquire);
+    if (!entry)
+      return nullptr;
+    if (entry->ExistingHash() == hash && HashTranslator::Equal(entry, value))
+      return entry;
+  }
+}
+
+}  // namespace WTF
+
+using WTF::SharedAtomicStringTable;
+
+#endif  // THIRD_PARTY_BLINK_RENDERER_PLATFORM_WTF_TEXT_SHARED_ATOMIC_STRING_TABLE_H_
@@ -0,0 +1,110 @@
+// Copyright 2020 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "third_party/blink/renderer/platform/wtf/text/shared_atomic_string_table.h"
+
+#include <string>
+
+#include "base/bind.h"
+#include "base/synchronization/waitable_event.h"
+#include "base/threading/thread.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/renderer/platform/wtf/text/string_hasher.h"
+
+namespace WTF {
+namespace {
+
+// Enough strings for every shard to grow at least once.
+constexpr wtf_size_t kNumStrings = 1000;
+
+std::string TestString(wtf_size_t i) {
+  return "shared-atomic-string-table-" + std::to_string(i);
+}
+
+StringImpl* CreateStaticString(wtf_size_t i) {
+  const std::string string = TestString(i);
+  return StringImpl::CreateStatic(
+      string.c_str(), string.size(),
+      StringHasher::ComputeHashAndMaskTop8Bits(
+          reinterpret_cast<const LChar*>(string.c_str()), string.size()));
+}
+
+scoped_refptr<StringImpl> CreateLookupKey(wtf_size_t i) {
+  const std::string string = TestString(i);
+  return StringImpl::Create(reinterpret_cast<const LChar*>(string.c_str()),
+                            string.size());
+}
+
+TEST(SharedAtomicStringTableTest, AddAndFind) {
+  SharedAtomicStringTable table;
+  StringImpl* string = CreateStaticString(0);
+  EXPECT_EQ(nullptr, table.Find(CreateLookupKey(0).get()));
+  EXPECT_EQ(string, table.Add(string));
+  EXPECT_EQ(1u, table.size());
+
+  // Lookups compare contents, not identity.
+  EXPECT_EQ(string, table.Find(CreateLookupKey(0).get()));
+  EXPECT_EQ(string, table.Find(string));
+  EXPECT_EQ(nullptr, table.Find(CreateLookupKey(1).get()));
+  EXPECT_EQ(nullptr, table.Find(StringImpl::empty_));
+
+  // Adding the same string again keeps the existing entry.
+  EXPECT_EQ(string, table.Add(string));
+  EXPECT_EQ(1u, table.size());
+}
+
+TEST(SharedAtomicStringTableTest, Grow) {
+  SharedAtomicStringTable table;
+  Vector<StringImpl*> strings;
+  for (wtf_size_t i = 0; i < kNumStrings; ++i) {
+    strings.push_back(CreateStaticString(i));
+    EXPECT_EQ(strings.back(), table.Add(strings.back()));
+  }
+  EXPECT_EQ(kNumStrings, table.size());
+  for (wtf_size_t i = 0; i < kNumStrings; ++i)
+    EXPECT_EQ(strings[i], table.Find(CreateLookupKey(i).get()));
+}
+
+void LookUpWhileGrowing(const SharedAtomicStringTable* table,
+                        const Vector<StringImpl*>* strings,
+                        base::WaitableEvent* started,
+                        base::WaitableEvent* done) {
+  started->Signal();
+  // Strings added before the thread started must always be found, even while
+  // the main thread grows the shards.
+  size_t misses = 0;
+  while (!done->IsSignaled()) {
+    for (wtf_size_t i = 0; i < strings->size(); ++i)
+      misses += table->Find(CreateLookupKey(i).get()) != (*strings)[i];
+  }
+  EXPECT_EQ(0u, misses);
+}
+
+TEST(SharedAtomicStringTableTest, LookupsDoNotRaceWithInsertions) {
+  SharedAtomicStringTable table;
+  Vector<StringImpl*> early_strings;
+  for (wtf_size_t i = 0; i < kNumStrings / 10; ++i) {
+    early_strings.push_back(CreateStaticString(i));
+    table.Add(early_strings.back());
+  }
+
+  base::Thread thread("lookup thread");
+  thread.StartAndWaitForTesting();
+  base::WaitableEvent started;
+  base::WaitableEvent done;
+  thread.task_runner()->PostTask(
+      FROM_HERE,
+      base::BindOnce(&LookUpWhileGrowing, base::Unretained(&table),
+                     base::Unretained(&early_strings),
+                     base::Unretained(&started), base::Unretained(&done)));
+  started.Wait();
+  for (wtf_size_t i = kNumStrings / 10; i < kNumStrings; ++i)
+    table.Add(CreateStaticString(i));
+  done.Signal();
+  thread.Stop();
+  EXPECT_EQ(kNumStrings, table.size());
+}
+
+}  // namespace
+}  // namespace WTF
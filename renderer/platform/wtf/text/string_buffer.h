@@ -83,7 +83,7 @@ void StringBuffer<CharType>::Shrink(unsigned new_length) {
   DCHECK(data_);
   if (data_->length() == new_length)
     return;
-  data_ = data_->Substring(0, new_length);
+  data_ = StringImpl::ShrinkUninitialized(std::move(data_), new_length);
 }
 
 }  // namespace WTF
@@ -7,6 +7,7 @@
 #include "third_party/blink/renderer/platform/wtf/text/string_buffer.h"
 
 #include "testing/gtest/include/gtest/gtest.h"
+#include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
 
 namespace WTF {
 
@@ -38,4 +39,27 @@ TEST(StringBufferTest, shrink) {
   EXPECT_EQ(0u, buf.length());
 }
 
+TEST(StringBufferTest, ShrinkKeepsAllocation) {
+  StringBuffer<UChar> buf(1000);
+  for (unsigned i = 0; i < buf.length(); ++i)
+    buf[i] = 'a' + i % 26;
+  const UChar* characters = buf.Characters();
+
+  // Shrinking by one character does not change the allocation size, so the
+  // characters are not copied.
+  buf.Shrink(999);
+  EXPECT_EQ(999u, buf.length());
+  EXPECT_EQ(characters, buf.Characters());
+
+  // Shrinking to a tenth of the size copies the characters.
+  buf.Shrink(100);
+  EXPECT_EQ(100u, buf.length());
+  for (unsigned i = 0; i < buf.length(); ++i)
+    EXPECT_EQ(static_cast<UChar>('a' + i % 26), buf[i]);
+
+  String string = String::Adopt(buf);
+  EXPECT_EQ(100u, string.length());
+  EXPECT_FALSE(string.Is8Bit());
+}
+
 }  // namespace WTF
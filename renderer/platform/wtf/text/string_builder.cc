@@ -36,6 +36,8 @@
 namespace WTF {
 
 String StringBuilder::ToString() {
+  if (rope_)
+    FlattenRope();
   if (!length_)
     return g_empty_string;
   if (string_.IsNull()) {
@@ -49,6 +51,8 @@ String StringBuilder::ToString() {
 }
 
 AtomicString StringBuilder::ToAtomicString() {
+  if (rope_)
+    FlattenRope();
   if (!length_)
     return g_empty_atom;
   if (string_.IsNull()) {
@@ -62,6 +66,7 @@ AtomicString StringBuilder::ToAtomicString() {
 }
 
 String StringBuilder::Substring(unsigned start, unsigned length) const {
+  DCHECK(!rope_);
   if (start >= length_)
     return g_empty_string;
   if (!string_.IsNull())
@@ -100,10 +105,12 @@ void StringBuilder::Swap(StringBuilder& builder) {
   else if (buffer16)
     new (&builder.buffer16_) Buffer16(std::move(*buffer16));
 
+  std::swap(rope_, builder.rope_);
   std::swap(string_, builder.string_);
   std::swap(length_, builder.length_);
   std::swap(is_8bit_, builder.is_8bit_);
   std::swap(has_buffer_, builder.has_buffer_);
+  std::swap(shares_large_strings_, builder.shares_large_strings_);
 }
 
 void StringBuilder::ClearBuffer() {
@@ -117,10 +124,13 @@ void StringBuilder::ClearBuffer() {
 }
 
 void StringBuilder::Ensure16Bit() {
+  if (rope_)
+    FlattenRope();
   EnsureBuffer16(0);
 }
 
 void StringBuilder::Clear() {
+  rope_.reset();
   ClearBuffer();
   string_ = String();
   length_ = 0;
@@ -143,6 +153,8 @@ void StringBuilder::ReserveCapacity(unsigned new_capacity) {
 }
 
 void StringBuilder::Resize(unsigned new_size) {
+  if (rope_)
+    FlattenRope();
   DCHECK_LE(new_size, length_);
   string_ = string_.Left(new_size);
   length_ = new_size;
@@ -157,6 +169,8 @@ void StringBuilder::Resize(unsigned new_size) {
 void StringBuilder::CreateBuffer8(unsigned added_size) {
   DCHECK(!HasBuffer());
   DCHECK(is_8bit_);
+  if (ShouldMoveSegmentToRope(added_size))
+    MoveSegmentToRope();
   new (&buffer8_) Buffer8;
   has_buffer_ = true;
   // createBuffer is called right before appending addedSize more bytes. We
@@ -177,6 +191,9 @@ void StringBuilder::CreateBuffer8(unsigned added_size) {
 
 void StringBuilder::CreateBuffer16(unsigned added_size) {
   DCHECK(is_8bit_ || !HasBuffer());
+  // This also avoids converting a large 8-bit buffer to 16 bits.
+  if (ShouldMoveSegmentToRope(added_size))
+    MoveSegmentToRope();
   Buffer8 buffer8;
   unsigned length = length_;
   if (has_buffer_) {
@@ -199,6 +216,84 @@ void StringBuilder::CreateBuffer16(unsigned added_size) {
   string_ = String();
 }
 
+void StringBuilder::AppendSharedString(StringImpl* impl) {
+  MoveSegmentToRope();
+  AppendPiece(impl);
+}
+
+void StringBuilder::AppendBuilderWithRope(const StringBuilder& other) {
+  DCHECK_NE(this, &other);
+  for (const String& piece : other.rope_->pieces)
+    Append(piece);
+  if (!other.length_)
+    return;
+  if (!other.string_.IsNull())
+    Append(other.string_);
+  else if (other.is_8bit_)
+    Append(other.buffer8_.data(), other.length_);
+  else
+    Append(other.buffer16_.data(), other.length_);
+}
+
+void StringBuilder::AppendPiece(String piece) {
+  DCHECK(!length_);
+  if (!rope_)
+    rope_ = std::make_unique<Rope>();
+  rope_->length += piece.length();
+  rope_->is_8bit = rope_->is_8bit && piece.Is8Bit();
+  rope_->pieces.push_back(std::move(piece));
+}
+
+void StringBuilder::MoveSegmentToRope() {
+  if (!length_)
+    return;
+  unsigned length = length_;
+  length_ = 0;
+  if (!string_.IsNull()) {
+    AppendPiece(std::move(string_));
+    string_ = String();
+    is_8bit_ = true;
+  } else if (is_8bit_) {
+    AppendPiece(String(buffer8_.data(), length));
+    buffer8_.Shrink(0);
+  } else {
+    AppendPiece(String(buffer16_.data(), length));
+    buffer16_.Shrink(0);
+  }
+}
+
+void StringBuilder::FlattenRope() {
+  MoveSegmentToRope();
+  std::unique_ptr<Rope> rope = std::move(rope_);
+  DCHECK(!rope->pieces.IsEmpty());
+  ClearBuffer();
+  length_ = rope->length;
+  is_8bit_ = rope->is_8bit;
+  if (rope->pieces.size() == 1) {
+    string_ = std::move(rope->pieces[0]);
+    return;
+  }
+  // Every character is copied once, directly in the final width.
+  if (is_8bit_) {
+    LChar* data;
+    string_ = StringImpl::CreateUninitialized(length_, data);
+    for (const String& piece : rope->pieces) {
+      StringImpl::CopyChars(data, piece.Characters8(), piece.length());
+      data += piece.length();
+    }
+    return;
+  }
+  UChar* data;
+  string_ = StringImpl::CreateUninitialized(length_, data);
+  for (const String& piece : rope->pieces) {
+    if (piece.Is8Bit())
+      StringImpl::CopyChars(data, piece.Characters8(), piece.length());
+    else
+      StringImpl::CopyChars(data, piece.Characters16(), piece.length());
+    data += piece.length();
+  }
+}
+
 void StringBuilder::Append(const UChar* characters, unsigned length) {
   if (!length)
     return;
@@ -269,6 +364,8 @@ void StringBuilder::AppendFormat(const char* format, ...) {
 }
 
 void StringBuilder::erase(unsigned index) {
+  if (rope_)
+    FlattenRope();
   if (index >= length_)
     return;
 
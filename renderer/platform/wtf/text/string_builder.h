@@ -27,6 +27,8 @@
 #ifndef THIRD_PARTY_BLINK_RENDERER_PLATFORM_WTF_TEXT_STRING_BUILDER_H_
 #define THIRD_PARTY_BLINK_RENDERER_PLATFORM_WTF_TEXT_STRING_BUILDER_H_
 
+#include <memory>
+
 #include "base/macros.h"
 #include "third_party/blink/renderer/platform/wtf/text/atomic_string.h"
 #include "third_party/blink/renderer/platform/wtf/text/integer_to_string_conversion.h"
@@ -40,9 +42,26 @@ class WTF_EXPORT StringBuilder {
   USING_FAST_MALLOC(StringBuilder);
 
  public:
+  // Strings of at least this length are referenced instead of copied by
+  // builders that share large strings. See ShareLargeStrings().
+  static constexpr unsigned kMinSharedStringLength = 256;
+
   StringBuilder() : no_buffer_() {}
   ~StringBuilder() { Clear(); }
 
+  // Makes the builder reference appended strings of at least
+  // kMinSharedStringLength characters instead of copying them, which suits
+  // builders that concatenate large strings, such as serializers. The contents
+  // are then kept as a list of pieces that ToString() and ToAtomicString()
+  // concatenate in a single pass, directly in the final width. When a 16-bit
+  // string is appended, a large 8-bit prefix is also kept as a piece instead
+  // of being converted.
+  //
+  // While the builder holds pieces, its characters can only be accessed after
+  // calling ToString(), not through Characters8(), Characters16(),
+  // operator[], Substring() or the conversion to StringView.
+  void ShareLargeStrings() { shares_large_strings_ = true; }
+
   void Append(const UChar*, unsigned length);
   void Append(const LChar*, unsigned length);
 
@@ -51,6 +70,11 @@ class WTF_EXPORT StringBuilder {
   }
 
   void Append(const StringBuilder& other) {
+    if (other.rope_) {
+      AppendBuilderWithRope(other);
+      return;
+    }
+
     if (!other.length_)
       return;
 
@@ -101,6 +125,12 @@ class WTF_EXPORT StringBuilder {
       return;
     }
 
+    if (impl && shares_large_strings_ &&
+        impl->length() >= kMinSharedStringLength) {
+      AppendSharedString(impl);
+      return;
+    }
+
     if (string.Is8Bit())
       Append(string.Characters8(), string.length());
     else
@@ -161,6 +191,7 @@ class WTF_EXPORT StringBuilder {
   String Substring(unsigned start, unsigned length) const;
 
   operator StringView() const {
+    DCHECK(!rope_);
     if (Is8Bit()) {
       return StringView(Characters8(), length());
     } else {
@@ -168,8 +199,8 @@ class WTF_EXPORT StringBuilder {
     }
   }
 
-  unsigned length() const { return length_; }
-  bool IsEmpty() const { return !length_; }
+  unsigned length() const { return rope_ ? rope_->length + length_ : length_; }
+  bool IsEmpty() const { return !length(); }
 
   unsigned Capacity() const;
   void ReserveCapacity(unsigned new_capacity);
@@ -179,6 +210,7 @@ class WTF_EXPORT StringBuilder {
 
   UChar operator[](unsigned i) const {
     SECURITY_DCHECK(i < length_);
+    DCHECK(!rope_);
     if (is_8bit_)
       return Characters8()[i];
     return Characters16()[i];
@@ -186,7 +218,8 @@ class WTF_EXPORT StringBuilder {
 
   const LChar* Characters8() const {
     DCHECK(is_8bit_);
-    if (!length())
+    DCHECK(!rope_);
+    if (!length_)
       return nullptr;
     if (!string_.IsNull())
       return string_.Characters8();
@@ -196,7 +229,8 @@ class WTF_EXPORT StringBuilder {
 
   const UChar* Characters16() const {
     DCHECK(!is_8bit_);
-    if (!length())
+    DCHECK(!rope_);
+    if (!length_)
       return nullptr;
     if (!string_.IsNull())
       return string_.Characters16();
@@ -204,7 +238,7 @@ class WTF_EXPORT StringBuilder {
     return buffer16_.data();
   }
 
-  bool Is8Bit() const { return is_8bit_; }
+  bool Is8Bit() const { return is_8bit_ && (!rope_ || rope_->is_8bit); }
   void Ensure16Bit();
 
   void Clear();
@@ -233,6 +267,34 @@ class WTF_EXPORT StringBuilder {
   void ClearBuffer();
   bool HasBuffer() const { return has_buffer_; }
 
+  // The contents that precede |string_| or the buffer, in builders that share
+  // large strings.
+  struct Rope {
+    USING_FAST_MALLOC(Rope);
+
+   public:
+    Vector<String> pieces;
+    unsigned length = 0;
+    bool is_8bit = true;
+  };
+
+  void AppendSharedString(StringImpl*);
+  void AppendBuilderWithRope(const StringBuilder&);
+  void AppendPiece(String);
+  // Moves the contents of |string_| or the buffer to the rope, keeping the
+  // capacity of the buffer.
+  void MoveSegmentToRope();
+  void FlattenRope();
+  // Whether the contents of |string_| or the buffer should be moved to the
+  // rope rather than copied to a new buffer.
+  bool ShouldMoveSegmentToRope(unsigned added_size) const {
+    // Callers that pass no |added_size|, like erase(), need the whole contents
+    // in the buffer.
+    return shares_large_strings_ && added_size &&
+           length_ >= kMinSharedStringLength;
+  }
+
+  std::unique_ptr<Rope> rope_;
   String string_;
   union {
     char no_buffer_;
@@ -242,6 +304,7 @@ class WTF_EXPORT StringBuilder {
   unsigned length_ = 0;
   bool is_8bit_ = true;
   bool has_buffer_ = false;
+  bool shares_large_strings_ = false;
 
   DISALLOW_COPY_AND_ASSIGN(StringBuilder);
 };
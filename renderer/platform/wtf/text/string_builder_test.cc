@@ -56,6 +56,11 @@ void ExpectEmpty(const StringBuilder& builder) {
   EXPECT_EQ(nullptr, builder.Characters8());
 }
 
+String LargeString(LChar character) {
+  Vector<LChar> characters(StringBuilder::kMinSharedStringLength, character);
+  return String(characters.data(), characters.size());
+}
+
 }  // namespace
 
 TEST(StringBuilderTest, DefaultConstructor) {
@@ -356,6 +361,92 @@ TEST(StringBuilderTest, Substring) {
   }
 }
 
+TEST(StringBuilderTest, ShareLargeStrings) {
+  const String large = LargeString('a');
+  StringBuilder builder;
+  builder.ShareLargeStrings();
+  builder.Append("<p>");
+  builder.Append(large);
+  builder.Append("</p>");
+  builder.Append(large);
+  EXPECT_EQ(2 * large.length() + 7, builder.length());
+  EXPECT_FALSE(builder.IsEmpty());
+  EXPECT_TRUE(builder.Is8Bit());
+  const String expected = "<p>" + large + "</p>" + large;
+  EXPECT_EQ(expected, builder.ToString());
+
+  // The result of ToString() is referenced by further appends.
+  builder.Append('!');
+  EXPECT_EQ(String(expected + "!"), builder.ToString());
+}
+
+TEST(StringBuilderTest, ShareLargeStringsSingleString) {
+  const String large = LargeString('a');
+  StringBuilder builder;
+  builder.ShareLargeStrings();
+  builder.ReserveCapacity(64);
+  builder.Append(large);
+  EXPECT_EQ(large.Impl(), builder.ToString().Impl());
+}
+
+TEST(StringBuilderTest, ShareLargeStringsSmallStrings) {
+  StringBuilder builder;
+  builder.ShareLargeStrings();
+  builder.Append(String("abc"));
+  builder.Append(String("def"));
+  // Small strings are copied, so the characters remain accessible.
+  ExpectBuilderContent("abcdef", builder);
+}
+
+TEST(StringBuilderTest, ShareLargeStringsMixedWidth) {
+  const String large8 = LargeString('a');
+  String large16 = large8;
+  large16.Ensure16Bit();
+  const String prefix = LargeString('b');
+  StringBuilder builder;
+  builder.ShareLargeStrings();
+  // An 8-bit buffer that is too large to be converted to 16 bits.
+  for (unsigned i = 0; i < prefix.length(); ++i)
+    builder.Append(prefix[i]);
+  builder.Append(kReplacementCharacter);
+  builder.Append(large16);
+  builder.Append(large8);
+  EXPECT_FALSE(builder.Is8Bit());
+  const String result = builder.ToString();
+  EXPECT_FALSE(result.Is8Bit());
+  EXPECT_EQ(String(prefix + String(&kReplacementCharacter, 1) + large8 +
+                   large8),
+            result);
+}
+
+TEST(StringBuilderTest, ShareLargeStringsAppendBuilder) {
+  const String large = LargeString('a');
+  StringBuilder builder;
+  builder.ShareLargeStrings();
+  builder.Append("x");
+  builder.Append(large);
+  builder.Append("yz");
+
+  StringBuilder other;
+  other.Append('<');
+  other.Append(builder);
+  ExpectBuilderContent("<x" + large + "yz", other);
+}
+
+TEST(StringBuilderTest, ShareLargeStringsModify) {
+  const String large = LargeString('a');
+  StringBuilder builder;
+  builder.ShareLargeStrings();
+  builder.Append("x");
+  builder.Append(large);
+  builder.Append("yz");
+  builder.erase(0);
+  builder.Resize(builder.length() - 1);
+  ExpectBuilderContent(large + "y", builder);
+  builder.Clear();
+  ExpectEmpty(builder);
+}
+
 TEST(StringBuilderTest, AppendNumberDoubleUChar) {
   const double kSomeNumber = 1.2345;
   StringBuilder reference;
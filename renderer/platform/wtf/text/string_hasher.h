@@ -22,6 +22,9 @@
 #ifndef THIRD_PARTY_BLINK_RENDERER_PLATFORM_WTF_TEXT_STRING_HASHER_H_
 #define THIRD_PARTY_BLINK_RENDERER_PLATFORM_WTF_TEXT_STRING_HASHER_H_
 
+#include <stdint.h>
+#include <string.h>
+
 #include "third_party/blink/renderer/platform/wtf/allocator/allocator.h"
 #include "third_party/blink/renderer/platform/wtf/text/unicode.h"
 
@@ -195,7 +198,71 @@ class StringHasher {
     return HashMemory(data, length);
   }
 
+  // HashMemory() above is kept bit-for-bit compatible with the string hash,
+  // which is serial in its input: every step depends on the previous one. Keys
+  // that are only ever hashed in memory (e.g. arrays of pointers used as cache
+  // keys) can use this variant instead. It consumes eight bytes per step in
+  // four independent lanes, so the lanes can be computed in parallel, and only
+  // combines them at the end. Its results differ from HashMemory() and from
+  // string hashes, and must not be persisted. Like HashMemory(), the top 8 bits
+  // are masked and 0 is never returned.
+  static unsigned HashMemoryWide(const void* data, unsigned length) {
+    constexpr unsigned kLanes = 4;
+    constexpr unsigned kStride = kLanes * sizeof(uint64_t);
+    const char* bytes = static_cast<const char*>(data);
+    uint64_t lanes[kLanes] = {kWideHashingLaneSeed0, kWideHashingLaneSeed1,
+                              kWideHashingLaneSeed2, kWideHashingLaneSeed3};
+    uint64_t result = kStringHashingStartValue ^ length;
+    for (; length >= kStride; bytes += kStride, length -= kStride) {
+      for (unsigned i = 0; i < kLanes; ++i)
+        lanes[i] =
+            MixWideLane(lanes[i], LoadWord(bytes + i * sizeof(uint64_t)));
+    }
+    for (unsigned i = 0; i < kLanes; ++i)
+      result = MixWideLane(result, lanes[i]);
+    for (; length >= sizeof(uint64_t);
+         bytes += sizeof(uint64_t), length -= sizeof(uint64_t)) {
+      result = MixWideLane(result, LoadWord(bytes));
+    }
+    if (length) {
+      uint64_t tail = 0;
+      memcpy(&tail, bytes, length);
+      result = MixWideLane(result, tail);
+    }
+
+    // Fold to 32 bits, then handle the flag bits and 0 like
+    // HashWithTop8BitsMasked().
+    result ^= result >> 33;
+    unsigned hash = static_cast<unsigned>(result ^ (result >> 32));
+    hash &= (1U << (sizeof(hash) * 8 - kFlagCount)) - 1;
+    if (!hash)
+      hash = 0x80000000 >> kFlagCount;
+    return hash;
+  }
+
+  template <size_t length>
+  static unsigned HashMemoryWide(const void* data) {
+    return HashMemoryWide(data, length);
+  }
+
  private:
+  static constexpr uint64_t kWideHashingLaneSeed0 = 0x9E3779B97F4A7C15ULL;
+  static constexpr uint64_t kWideHashingLaneSeed1 = 0xC2B2AE3D27D4EB4FULL;
+  static constexpr uint64_t kWideHashingLaneSeed2 = 0x165667B19E3779F9ULL;
+  static constexpr uint64_t kWideHashingLaneSeed3 = 0x85EBCA77C2B2AE63ULL;
+
+  static uint64_t LoadWord(const char* bytes) {
+    uint64_t word;
+    memcpy(&word, bytes, sizeof(word));
+    return word;
+  }
+
+  static uint64_t MixWideLane(uint64_t lane, uint64_t word) {
+    lane ^= word;
+    lane *= kWideHashingLaneSeed0;
+    return lane ^ (lane >> 29);
+  }
+
   static UChar DefaultConverter(UChar character) { return character; }
 
   static UChar DefaultConverter(LChar character) { return character; }
@@ -25,7 +25,12 @@
 
 #include "third_party/blink/renderer/platform/wtf/text/string_hasher.h"
 
+#include <string>
+
+#include "base/time/time.h"
 #include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+#include "third_party/blink/renderer/platform/wtf/vector.h"
 
 namespace WTF {
 
@@ -53,6 +58,40 @@ const unsigned kTestBHash3 = 0x59EB1B2C;
 const unsigned kTestBHash4 = 0xA7BCCC0A;
 const unsigned kTestBHash5 = 0x79201649;
 
+constexpr char kMetricPrefixStringHasher[] = "StringHasher.";
+constexpr char kMetricThroughput[] = "throughput";
+constexpr size_t kBenchmarkBytes = 16 * 1024 * 1024;
+
+// Hashes |key_length| characters at a time until |kBenchmarkBytes| have been
+// hashed and reports the throughput. Short keys are dominated by setup and
+// finalization, long keys by the main loop.
+template <typename Function>
+void RunHashBenchmark(const std::string& story_name,
+                      size_t key_bytes,
+                      Function hash) {
+  const size_t iterations = kBenchmarkBytes / key_bytes;
+  unsigned accumulated = 0;
+  const base::TimeTicks start = base::TimeTicks::Now();
+  for (size_t i = 0; i < iterations; ++i)
+    accumulated += hash(i);
+  const base::TimeDelta duration = base::TimeTicks::Now() - start;
+  EXPECT_NE(0u, accumulated);
+
+  perf_test::PerfResultReporter reporter(kMetricPrefixStringHasher,
+                                         story_name);
+  reporter.RegisterImportantMetric(kMetricThroughput, "bytesPerSecond");
+  reporter.AddResult(kMetricThroughput,
+                     iterations * key_bytes / duration.InSecondsF());
+}
+
+template <typename CharType>
+Vector<CharType> BenchmarkCharacters(wtf_size_t length) {
+  Vector<CharType> characters(length);
+  for (wtf_size_t i = 0; i < length; ++i)
+    characters[i] = static_cast<CharType>('a' + i % 26);
+  return characters;
+}
+
 }  // anonymous namespace
 
 TEST(StringHasherTest, StringHasher) {
@@ -427,4 +466,66 @@ TEST(StringHasherTest, StringHasher_hashMemory) {
   EXPECT_EQ(kTestBHash5 & 0xFFFFFF, StringHasher::HashMemory<10>(kTestBUChars));
 }
 
+TEST(StringHasherTest, StringHasher_hashMemoryWide) {
+  const uint64_t kWords[6] = {1, 2, 3, 4, 5, 6};
+  const uint64_t kOtherWords[6] = {1, 2, 3, 4, 5, 7};
+
+  for (unsigned length = 0; length <= sizeof(kWords); ++length) {
+    unsigned hash = StringHasher::HashMemoryWide(kWords, length);
+    // The top 8 bits are reserved for flags and 0 is never returned.
+    EXPECT_EQ(0u, hash >> (32 - StringHasher::kFlagCount));
+    EXPECT_NE(0u, hash);
+    EXPECT_EQ(hash, StringHasher::HashMemoryWide(kWords, length));
+    if (length)
+      EXPECT_NE(hash, StringHasher::HashMemoryWide(kWords, length - 1));
+  }
+  EXPECT_EQ(StringHasher::HashMemoryWide(kWords, sizeof(kWords)),
+            StringHasher::HashMemoryWide<sizeof(kWords)>(kWords));
+  // A difference in the last word, which is hashed after the lanes are
+  // combined, changes the hash.
+  EXPECT_NE(StringHasher::HashMemoryWide(kWords, sizeof(kWords)),
+            StringHasher::HashMemoryWide(kOtherWords, sizeof(kOtherWords)));
+  // A difference in a word that goes through one of the lanes, too.
+  const uint64_t kLaneWords[4] = {1, 2, 3, 5};
+  EXPECT_NE(StringHasher::HashMemoryWide(kWords, sizeof(kLaneWords)),
+            StringHasher::HashMemoryWide(kLaneWords, sizeof(kLaneWords)));
+
+  // The input does not need to be aligned.
+  uint8_t unaligned[sizeof(kWords) + 1];
+  memcpy(unaligned + 1, kWords, sizeof(kWords));
+  EXPECT_EQ(StringHasher::HashMemoryWide(kWords, sizeof(kWords)),
+            StringHasher::HashMemoryWide(unaligned + 1, sizeof(kWords)));
+}
+
+TEST(StringHasherTest, HashPerformance) {
+  for (wtf_size_t length : {8u, 1024u}) {
+    const std::string suffix = "_" + std::to_string(length);
+    Vector<LChar> latin1 = BenchmarkCharacters<LChar>(length);
+    Vector<UChar> utf16 = BenchmarkCharacters<UChar>(length);
+
+    RunHashBenchmark("compute_hash_8bit" + suffix, length, [&](size_t i) {
+      latin1[0] = static_cast<LChar>(i);
+      return StringHasher::ComputeHashAndMaskTop8Bits(latin1.data(), length);
+    });
+    RunHashBenchmark(
+        "compute_hash_16bit" + suffix, length * sizeof(UChar), [&](size_t i) {
+          utf16[0] = static_cast<UChar>(i);
+          return StringHasher::ComputeHashAndMaskTop8Bits(utf16.data(),
+                                                          length);
+        });
+    RunHashBenchmark(
+        "hash_memory" + suffix, length * sizeof(UChar), [&](size_t i) {
+          utf16[0] = static_cast<UChar>(i);
+          return StringHasher::HashMemory(utf16.data(),
+                                          length * sizeof(UChar));
+        });
+    RunHashBenchmark(
+        "hash_memory_wide" + suffix, length * sizeof(UChar), [&](size_t i) {
+          utf16[0] = static_cast<UChar>(i);
+          return StringHasher::HashMemoryWide(utf16.data(),
+                                              length * sizeof(UChar));
+        });
+  }
+}
+
 }  // namespace WTF
@@ -27,6 +27,7 @@
 
 #include <algorithm>
 #include <memory>
+#include "build/build_config.h"
 #include "third_party/blink/renderer/platform/wtf/allocator/partitions.h"
 #include "third_party/blink/renderer/platform/wtf/dynamic_annotations.h"
 #include "third_party/blink/renderer/platform/wtf/leak_annotations.h"
@@ -39,6 +40,12 @@
 #include "third_party/blink/renderer/platform/wtf/text/string_hash.h"
 #include "third_party/blink/renderer/platform/wtf/text/string_to_number.h"
 
+#if defined(ARCH_CPU_X86_FAMILY) && defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 using std::numeric_limits;
 
 namespace WTF {
@@ -134,6 +141,40 @@ scoped_refptr<StringImpl> StringImpl::CreateUninitialized(wtf_size_t length,
   return base::AdoptRef(new (string) StringImpl(length));
 }
 
+scoped_refptr<StringImpl> StringImpl::ShrinkUninitialized(
+    scoped_refptr<StringImpl> string,
+    wtf_size_t length) {
+  DCHECK(string->HasOneRef());
+  DCHECK(!string->IsStatic());
+  DCHECK(!string->IsAtomic());
+  DCHECK_LE(length, string->length());
+  if (length == string->length())
+    return string;
+  if (!length)
+    return empty_;
+
+  const bool is_8bit = string->Is8Bit();
+  const size_t current_size = is_8bit
+                                  ? AllocationSize<LChar>(string->length())
+                                  : AllocationSize<UChar>(string->length());
+  const size_t new_size = is_8bit ? AllocationSize<LChar>(length)
+                                  : AllocationSize<UChar>(length);
+  if (Partitions::BufferActualSize(new_size) !=
+      Partitions::BufferActualSize(current_size)) {
+    return string->Substring(0, length);
+  }
+
+  // Rewrite the header in place. |string| keeps the only reference, which the
+  // new header starts with.
+  StringImpl* impl = string.get();
+  impl->~StringImpl();
+  if (is_8bit)
+    new (impl) StringImpl(length, kForce8BitConstructor);
+  else
+    new (impl) StringImpl(length);
+  return string;
+}
+
 static StaticStringsTable& StaticStrings() {
   DEFINE_STATIC_LOCAL(StaticStringsTable, static_strings, ());
   return static_strings;
@@ -1625,6 +1666,44 @@ inline bool EqualInternal(const StringImpl* a,
   return Equal(a->Characters16(), b, length);
 }
 
+bool EqualVectorized(const LChar* a, const UChar* b, wtf_size_t length) {
+  wtf_size_t i = 0;
+  // Each iteration widens 16 Latin-1 characters to UTF-16 and compares them
+  // against 16 UTF-16 characters.
+#if defined(ARCH_CPU_X86_FAMILY) && defined(__SSE2__)
+  const __m128i zero = _mm_setzero_si128();
+  for (; i + 16 <= length; i += 16) {
+    __m128i narrow = _mm_loadu_si128(reinterpret_cast<const __m128i*>(a + i));
+    __m128i wide_low =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i));
+    __m128i wide_high =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(b + i + 8));
+    __m128i equal = _mm_and_si128(
+        _mm_cmpeq_epi16(_mm_unpacklo_epi8(narrow, zero), wide_low),
+        _mm_cmpeq_epi16(_mm_unpackhi_epi8(narrow, zero), wide_high));
+    if (_mm_movemask_epi8(equal) != 0xFFFF)
+      return false;
+  }
+#elif defined(__ARM_NEON)
+  const uint16_t* wide = reinterpret_cast<const uint16_t*>(b);
+  for (; i + 16 <= length; i += 16) {
+    uint8x16_t narrow = vld1q_u8(a + i);
+    uint16x8_t equal = vandq_u16(
+        vceqq_u16(vmovl_u8(vget_low_u8(narrow)), vld1q_u16(wide + i)),
+        vceqq_u16(vmovl_u8(vget_high_u8(narrow)), vld1q_u16(wide + i + 8)));
+    uint64x2_t equal64 = vreinterpretq_u64_u16(equal);
+    if ((vgetq_lane_u64(equal64, 0) & vgetq_lane_u64(equal64, 1)) !=
+        ~uint64_t{0})
+      return false;
+  }
+#endif
+  for (; i < length; ++i) {
+    if (a[i] != b[i])
+      return false;
+  }
+  return true;
+}
+
 bool Equal(const StringImpl* a, const LChar* b, wtf_size_t length) {
   return EqualInternal(a, b, length);
 }
@@ -199,6 +199,13 @@ class WTF_EXPORT StringImpl {
                                                        LChar*& data);
   static scoped_refptr<StringImpl> CreateUninitialized(wtf_size_t length,
                                                        UChar*& data);
+  // Returns the first |length| characters of |string|, which must come from
+  // CreateUninitialized() and must not be shared. The characters are not
+  // copied when the allocation of |string| has the size that a new string of
+  // |length| characters would get.
+  static scoped_refptr<StringImpl> ShrinkUninitialized(
+      scoped_refptr<StringImpl> string,
+      wtf_size_t length);
 
   wtf_size_t length() const { return length_; }
   bool Is8Bit() const { return is_8bit_; }
@@ -566,7 +573,16 @@ ALWAYS_INLINE bool Equal(const CharType* a,
   return !memcmp(a, b, length * sizeof(CharType));
 }
 
+// Compares mixed-width characters with SIMD where available. Same-width
+// comparisons above go through memcmp(), which is already vectorized.
+WTF_EXPORT bool EqualVectorized(const LChar*, const UChar*, wtf_size_t length);
+
+// Below this length, setting up the vector loop costs more than it saves.
+constexpr wtf_size_t kMinLengthForVectorizedEqual = 16;
+
 ALWAYS_INLINE bool Equal(const LChar* a, const UChar* b, wtf_size_t length) {
+  if (length >= kMinLengthForVectorizedEqual)
+    return EqualVectorized(a, b, length);
   for (wtf_size_t i = 0; i < length; ++i) {
     if (a[i] != b[i])
       return false;
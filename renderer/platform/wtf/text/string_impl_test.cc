@@ -161,4 +161,30 @@ TEST(StringImplTest, UpperASCII) {
       StringImpl::Create(kTestWithNonASCIIComparison, 2)->UpperASCII().get()));
 }
 
+TEST(StringImplTest, EqualLatin1AndUTF16) {
+  // Covers lengths below, at and above the vectorized comparison threshold,
+  // with a mismatch at each position.
+  for (wtf_size_t length = 0; length < 3 * kMinLengthForVectorizedEqual;
+       ++length) {
+    Vector<LChar> latin1(length);
+    Vector<UChar> utf16(length);
+    for (wtf_size_t i = 0; i < length; ++i) {
+      latin1[i] = static_cast<LChar>(0x80 + i);
+      utf16[i] = latin1[i];
+    }
+    EXPECT_TRUE(Equal(latin1.data(), utf16.data(), length)) << length;
+    EXPECT_TRUE(Equal(utf16.data(), latin1.data(), length)) << length;
+
+    for (wtf_size_t i = 0; i < length; ++i) {
+      // A difference in the high byte only.
+      utf16[i] = latin1[i] | 0x100;
+      EXPECT_FALSE(Equal(latin1.data(), utf16.data(), length)) << length;
+      // A difference in the low byte only.
+      utf16[i] = latin1[i] ^ 1;
+      EXPECT_FALSE(Equal(latin1.data(), utf16.data(), length)) << length;
+      utf16[i] = latin1[i];
+    }
+  }
+}
+
 }  // namespace WTF
@@ -25,13 +25,21 @@
 
 #include "third_party/blink/renderer/platform/wtf/text/text_codec_utf8.h"
 
+#include <algorithm>
 #include <memory>
 #include "base/memory/ptr_util.h"
 #include "base/numerics/checked_math.h"
+#include "build/build_config.h"
 #include "third_party/blink/renderer/platform/wtf/text/character_names.h"
 #include "third_party/blink/renderer/platform/wtf/text/string_buffer.h"
 #include "third_party/blink/renderer/platform/wtf/text/text_codec_ascii_fast_path.h"
 
+#if defined(ARCH_CPU_X86_FAMILY) && defined(__SSE2__)
+#include <emmintrin.h>
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
 namespace WTF {
 
 // We'll use nonCharacter* constants to signal invalid utf-8.
@@ -144,6 +152,115 @@ static inline int DecodeNonASCIISequence(const uint8_t* sequence,
          0x03C82080;
 }
 
+#if defined(ARCH_CPU_X86_FAMILY) && defined(__SSE2__)
+static inline void StoreASCIIBlock(LChar* destination, __m128i block) {
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(destination), block);
+}
+
+static inline void StoreASCIIBlock(UChar* destination, __m128i block) {
+  const __m128i zero = _mm_setzero_si128();
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(destination),
+                   _mm_unpacklo_epi8(block, zero));
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + 8),
+                   _mm_unpackhi_epi8(block, zero));
+}
+#elif defined(__ARM_NEON)
+static inline void StoreASCIIBlock(LChar* destination, uint8x16_t block) {
+  vst1q_u8(destination, block);
+}
+
+static inline void StoreASCIIBlock(UChar* destination, uint8x16_t block) {
+  uint16_t* wide = reinterpret_cast<uint16_t*>(destination);
+  vst1q_u16(wide, vmovl_u8(vget_low_u8(block)));
+  vst1q_u16(wide + 8, vmovl_u8(vget_high_u8(block)));
+}
+#endif
+
+// Copies the ASCII bytes at the start of |source| to |destination| and
+// returns their number. Most UTF-8 text on the web is ASCII, including the
+// markup and punctuation of text in other scripts, so this is the hot loop of
+// decoding.
+template <typename CharType>
+static inline wtf_size_t CopyASCIIPrefix(CharType* destination,
+                                         const uint8_t* source,
+                                         wtf_size_t length) {
+  wtf_size_t i = 0;
+  // Each iteration checks and copies 16 bytes, widening them to UTF-16 in the
+  // 16-bit path.
+#if defined(ARCH_CPU_X86_FAMILY) && defined(__SSE2__)
+  for (; i + 16 <= length; i += 16) {
+    __m128i block =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+    if (_mm_movemask_epi8(block))
+      break;
+    StoreASCIIBlock(destination + i, block);
+  }
+#elif defined(__ARM_NEON)
+  for (; i + 16 <= length; i += 16) {
+    uint8x16_t block = vld1q_u8(source + i);
+    uint64x2_t block64 = vreinterpretq_u64_u8(block);
+    if ((vgetq_lane_u64(block64, 0) | vgetq_lane_u64(block64, 1)) &
+        UINT64_C(0x8080808080808080))
+      break;
+    StoreASCIIBlock(destination + i, block);
+  }
+#else
+  for (; i + sizeof(MachineWord) <= length; i += sizeof(MachineWord)) {
+    MachineWord chunk;
+    memcpy(&chunk, source + i, sizeof(MachineWord));
+    if (!IsAllASCII<LChar>(chunk))
+      break;
+    CopyASCIIMachineWord(destination + i, source + i);
+  }
+#endif
+  for (; i < length && IsASCII(source[i]); ++i)
+    destination[i] = source[i];
+  return i;
+}
+
+// Copies the ASCII characters at the start of |source| to |destination| as
+// UTF-8 and returns their number.
+static inline wtf_size_t CopyASCIIPrefixToUTF8(uint8_t* destination,
+                                               const LChar* source,
+                                               wtf_size_t length) {
+  return CopyASCIIPrefix(destination, source, length);
+}
+
+static inline wtf_size_t CopyASCIIPrefixToUTF8(uint8_t* destination,
+                                               const UChar* source,
+                                               wtf_size_t length) {
+  wtf_size_t i = 0;
+  // Each iteration checks 16 UTF-16 code units and narrows them to bytes.
+#if defined(ARCH_CPU_X86_FAMILY) && defined(__SSE2__)
+  const __m128i non_ascii_mask = _mm_set1_epi16(static_cast<int16_t>(0xFF80));
+  const __m128i zero = _mm_setzero_si128();
+  for (; i + 16 <= length; i += 16) {
+    __m128i low = _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i));
+    __m128i high =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(source + i + 8));
+    __m128i non_ascii = _mm_and_si128(_mm_or_si128(low, high), non_ascii_mask);
+    if (_mm_movemask_epi8(_mm_cmpeq_epi16(non_ascii, zero)) != 0xFFFF)
+      break;
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(destination + i),
+                     _mm_packus_epi16(low, high));
+  }
+#elif defined(__ARM_NEON)
+  const uint16_t* wide = reinterpret_cast<const uint16_t*>(source);
+  for (; i + 16 <= length; i += 16) {
+    uint16x8_t low = vld1q_u16(wide + i);
+    uint16x8_t high = vld1q_u16(wide + i + 8);
+    uint64x2_t both = vreinterpretq_u64_u16(vorrq_u16(low, high));
+    if ((vgetq_lane_u64(both, 0) | vgetq_lane_u64(both, 1)) &
+        UINT64_C(0xFF80FF80FF80FF80))
+      break;
+    vst1q_u8(destination + i, vcombine_u8(vmovn_u16(low), vmovn_u16(high)));
+  }
+#endif
+  for (; i < length && IsASCII(source[i]); ++i)
+    destination[i] = static_cast<uint8_t>(source[i]);
+  return i;
+}
+
 static inline UChar* AppendCharacter(UChar* destination, int character) {
   DCHECK(!IsNonCharacter(character));
   DCHECK(!U_IS_SURROGATE(character));
@@ -299,7 +416,6 @@ String TextCodecUTF8::Decode(const char* bytes,
 
   const uint8_t* source = reinterpret_cast<const uint8_t*>(bytes);
   const uint8_t* end = source + length;
-  const uint8_t* aligned_end = AlignToMachineWord(end);
   LChar* destination = buffer.Characters();
 
   do {
@@ -323,23 +439,10 @@ String TextCodecUTF8::Decode(const char* bytes,
 
     while (source < end) {
       if (IsASCII(*source)) {
-        // Fast path for ASCII. Most UTF-8 text will be ASCII.
-        if (IsAlignedToMachineWord(source)) {
-          while (source < aligned_end) {
-            MachineWord chunk =
-                *reinterpret_cast_ptr<const MachineWord*>(source);
-            if (!IsAllASCII<LChar>(chunk))
-              break;
-            CopyASCIIMachineWord(destination, source);
-            source += sizeof(MachineWord);
-            destination += sizeof(MachineWord);
-          }
-          if (source == end)
-            break;
-          if (!IsASCII(*source))
-            continue;
-        }
-        *destination++ = *source++;
+        wtf_size_t ascii_length = CopyASCIIPrefix(
+            destination, source, static_cast<wtf_size_t>(end - source));
+        source += ascii_length;
+        destination += ascii_length;
         continue;
       }
       int count = NonASCIISequenceLength(*source);
@@ -405,23 +508,10 @@ upConvertTo16Bit:
 
     while (source < end) {
       if (IsASCII(*source)) {
-        // Fast path for ASCII. Most UTF-8 text will be ASCII.
-        if (IsAlignedToMachineWord(source)) {
-          while (source < aligned_end) {
-            MachineWord chunk =
-                *reinterpret_cast_ptr<const MachineWord*>(source);
-            if (!IsAllASCII<LChar>(chunk))
-              break;
-            CopyASCIIMachineWord(destination16, source);
-            source += sizeof(MachineWord);
-            destination16 += sizeof(MachineWord);
-          }
-          if (source == end)
-            break;
-          if (!IsASCII(*source))
-            continue;
-        }
-        *destination16++ = *source++;
+        wtf_size_t ascii_length = CopyASCIIPrefix(
+            destination16, source, static_cast<wtf_size_t>(end - source));
+        source += ascii_length;
+        destination16 += ascii_length;
         continue;
       }
       int count = NonASCIISequenceLength(*source);
@@ -479,6 +569,13 @@ std::string TextCodecUTF8::EncodeCommon(const CharType* characters,
   wtf_size_t i = 0;
   wtf_size_t bytes_written = 0;
   while (i < length) {
+    wtf_size_t ascii_length = CopyASCIIPrefixToUTF8(
+        bytes.data() + bytes_written, characters + i, length - i);
+    i += ascii_length;
+    bytes_written += ascii_length;
+    if (i == length)
+      break;
+
     UChar32 character;
     U16_NEXT(characters, i, length, character);
     // U16_NEXT will simply emit a surrogate code point if an unmatched
@@ -505,6 +602,15 @@ TextCodec::EncodeIntoResult TextCodecUTF8::EncodeIntoCommon(
   bool is_error = false;
   while (i < length && encode_into_result.bytes_written < capacity &&
          !is_error) {
+    wtf_size_t ascii_length = CopyASCIIPrefixToUTF8(
+        destination + encode_into_result.bytes_written, characters + i,
+        static_cast<wtf_size_t>(std::min<size_t>(
+            length - i, capacity - encode_into_result.bytes_written)));
+    i += ascii_length;
+    encode_into_result.bytes_written += ascii_length;
+    if (i == length || encode_into_result.bytes_written == capacity)
+      break;
+
     UChar32 character;
     previous_code_unit_index = i;
     U16_NEXT(characters, i, length, character);
@@ -0,0 +1,81 @@
+// Copyright 2020 The Chromium Authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include <memory>
+#include <string>
+
+#include "base/time/time.h"
+#include "testing/gtest/include/gtest/gtest.h"
+#include "testing/perf/perf_result_reporter.h"
+#include "third_party/blink/renderer/platform/wtf/text/text_codec.h"
+#include "third_party/blink/renderer/platform/wtf/text/text_encoding.h"
+#include "third_party/blink/renderer/platform/wtf/text/text_encoding_registry.h"
+#include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
+
+namespace WTF {
+
+namespace {
+
+constexpr char kMetricPrefixTextCodecUTF8[] = "TextCodecUTF8.";
+constexpr char kMetricDecodeThroughput[] = "decode_throughput";
+
+constexpr size_t kInputSize = 1 << 20;
+constexpr int kNumRounds = 20;
+
+// Repeats |unit| up to about kInputSize bytes.
+std::string MakeInput(const std::string& unit) {
+  std::string input;
+  while (input.size() < kInputSize)
+    input += unit;
+  return input;
+}
+
+void RunBenchmark(const std::string& story_name,
+                  const std::string& input,
+                  bool expect_8bit) {
+  perf_test::PerfResultReporter reporter(kMetricPrefixTextCodecUTF8,
+                                         story_name);
+  reporter.RegisterImportantMetric(kMetricDecodeThroughput, "MB/s");
+
+  std::unique_ptr<TextCodec> codec(NewTextCodec(TextEncoding("UTF-8")));
+  bool saw_error = false;
+  base::TimeTicks start = base::TimeTicks::Now();
+  for (int round = 0; round < kNumRounds; ++round) {
+    String result = codec->Decode(
+        input.data(), static_cast<wtf_size_t>(input.size()),
+        FlushBehavior::kDataEOF, false, saw_error);
+    EXPECT_EQ(expect_8bit, result.Is8Bit());
+  }
+  base::TimeDelta elapsed = base::TimeTicks::Now() - start;
+  EXPECT_FALSE(saw_error);
+  reporter.AddResult(kMetricDecodeThroughput,
+                     kNumRounds * input.size() / elapsed.InSecondsF() /
+                         (1024 * 1024));
+}
+
+TEST(TextCodecUTF8PerfTest, Ascii) {
+  RunBenchmark("ascii",
+               MakeInput("<div class=\"item\">Hello, world! 0123</div>\n"),
+               true);
+}
+
+// Markup around Latin-1 text decodes to 8-bit strings.
+TEST(TextCodecUTF8PerfTest, Latin1) {
+  RunBenchmark("latin1",
+               MakeInput("<p>Caf\xc3\xa9 cr\xc3\xa8me br\xc3\xbbl\xc3\xa9"
+                         "e, s'il vous pla\xc3\xaet.</p>\n"),
+               true);
+}
+
+// Markup around CJK text decodes to 16-bit strings.
+TEST(TextCodecUTF8PerfTest, Cjk) {
+  RunBenchmark("cjk",
+               MakeInput("<p>\xe6\xbc\xa2\xe5\xad\x97\xe3\x81\xa8\xe4\xbb\xae"
+                         "\xe5\x90\x8d</p>\n"),
+               false);
+}
+
+}  // namespace
+
+}  // namespace WTF
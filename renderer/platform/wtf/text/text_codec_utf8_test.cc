@@ -32,10 +32,15 @@
 
 #include <limits>
 #include <memory>
+#include <string>
+#include <vector>
+
+#include "base/stl_util.h"
 #include "testing/gtest/include/gtest/gtest.h"
 #include "third_party/blink/renderer/platform/wtf/text/text_codec.h"
 #include "third_party/blink/renderer/platform/wtf/text/text_encoding.h"
 #include "third_party/blink/renderer/platform/wtf/text/text_encoding_registry.h"
+#include "third_party/blink/renderer/platform/wtf/text/utf8.h"
 #include "third_party/blink/renderer/platform/wtf/text/wtf_string.h"
 
 namespace WTF {
@@ -90,6 +95,107 @@ TEST(TextCodecUTF8, Decode0xFF) {
   EXPECT_EQ(0xFFFDU, result[0]);
 }
 
+String DecodeUTF8(const std::string& bytes) {
+  std::unique_ptr<TextCodec> codec(NewTextCodec(TextEncoding("UTF-8")));
+  bool saw_error = false;
+  String result =
+      codec->Decode(bytes.data(), static_cast<wtf_size_t>(bytes.size()),
+                    FlushBehavior::kDataEOF, false, saw_error);
+  EXPECT_FALSE(saw_error);
+  return result;
+}
+
+// Places a non-ASCII character at every offset of text that is long enough
+// for the vectorized ASCII loop.
+TEST(TextCodecUTF8, DecodeNonASCIIAtEveryOffset) {
+  const std::string ascii(48, 'a');
+  // U+00E9 decodes to an 8-bit string, U+20AC to a 16-bit one.
+  const struct {
+    const char* bytes;
+    UChar character;
+  } kCases[] = {{"\xc3\xa9", 0xE9}, {"\xe2\x82\xac", 0x20AC}};
+  for (const auto& test_case : kCases) {
+    for (size_t offset = 0; offset <= ascii.size(); ++offset) {
+      String result = DecodeUTF8(ascii.substr(0, offset) + test_case.bytes +
+                                 ascii.substr(offset));
+      ASSERT_EQ(ascii.size() + 1, result.length());
+      EXPECT_EQ(test_case.character <= 0xFF, result.Is8Bit());
+      for (wtf_size_t i = 0; i < result.length(); ++i)
+        EXPECT_EQ(i == offset ? test_case.character : 'a', result[i]);
+    }
+  }
+}
+
+TEST(TextCodecUTF8, DecodeLongAsciiInChunks) {
+  std::unique_ptr<TextCodec> codec(NewTextCodec(TextEncoding("UTF-8")));
+  const std::string bytes = std::string(40, 'a') + "\xe6\xbc\xa2" +
+                            std::string(40, 'b');
+  // The character is split between the first and the second chunk.
+  bool saw_error = false;
+  String first = codec->Decode(bytes.data(), 41, FlushBehavior::kDoNotFlush,
+                               false, saw_error);
+  String second = codec->Decode(
+      bytes.data() + 41, static_cast<wtf_size_t>(bytes.size() - 41),
+      FlushBehavior::kDataEOF, false, saw_error);
+  EXPECT_FALSE(saw_error);
+  EXPECT_EQ(String(std::string(40, 'a').c_str()), first);
+  ASSERT_EQ(41u, second.length());
+  EXPECT_EQ(0x6f22U, second[0]);
+  EXPECT_EQ(String(std::string(40, 'b').c_str()), second.Substring(1));
+}
+
+// Text long enough for the vectorized ASCII loops, with characters that take
+// two, three and four bytes and an unpaired surrogate in the middle.
+String EncodeTestString() {
+  const UChar kNonASCII[] = {0xE9, 0x20AC, 0xD83D, 0xDE00, 0xD800, 'x'};
+  String ascii(std::string(40, 'a').c_str());
+  return ascii + String(kNonASCII, base::size(kNonASCII)) + ascii;
+}
+
+TEST(TextCodecUTF8, EncodeMatchesCalculatedLength) {
+  std::unique_ptr<TextCodec> codec(NewTextCodec(TextEncoding("UTF-8")));
+  const String string = EncodeTestString();
+  std::string encoded = codec->Encode(string.Characters16(), string.length(),
+                                      kNoUnencodables);
+  // 2 + 3 + 4 bytes, and U+FFFD for the unpaired surrogate.
+  EXPECT_EQ(80u + 1 + 2 + 3 + 4 + 3, encoded.size());
+  EXPECT_EQ(encoded.size(), unicode::CalculateUTF8Length(string.Characters16(),
+                                                         string.length()));
+  EXPECT_EQ(std::string(40, 'a') + "\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80"
+                                   "\xef\xbf\xbdx" +
+                std::string(40, 'a'),
+            encoded);
+
+  const String latin1 = "caf\xe9 " + String(std::string(40, 'a').c_str());
+  EXPECT_EQ(codec
+                ->Encode(latin1.Characters8(), latin1.length(),
+                         kNoUnencodables)
+                .size(),
+            unicode::CalculateUTF8Length(latin1.Characters8(),
+                                         latin1.length()));
+}
+
+TEST(TextCodecUTF8, EncodeIntoStopsAtCapacity) {
+  std::unique_ptr<TextCodec> codec(NewTextCodec(TextEncoding("UTF-8")));
+  const String string = EncodeTestString();
+  const std::string expected = codec->Encode(
+      string.Characters16(), string.length(), kNoUnencodables);
+  for (size_t capacity = 0; capacity <= expected.size(); ++capacity) {
+    std::vector<unsigned char> destination(capacity + 1, 0xFF);
+    TextCodec::EncodeIntoResult result = codec->EncodeInto(
+        string.Characters16(), string.length(), destination.data(), capacity);
+    // Only whole characters are written.
+    ASSERT_LE(result.bytes_written, capacity);
+    EXPECT_EQ(expected.substr(0, result.bytes_written),
+              std::string(destination.begin(),
+                          destination.begin() + result.bytes_written));
+    EXPECT_EQ(0xFF, destination[result.bytes_written]);
+    EXPECT_EQ(result.bytes_written,
+              unicode::CalculateUTF8Length(string.Characters16(),
+                                           result.code_units_read));
+  }
+}
+
 TEST(TextCodecUTF8, DecodeOverflow) {
   TextEncoding encoding("UTF-8");
   std::unique_ptr<TextCodec> codec(NewTextCodec(encoding));
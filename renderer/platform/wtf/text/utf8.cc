@@ -458,6 +458,35 @@ ALWAYS_INLINE bool EqualWithUTF8Internal(const CharType* a,
   return a == a_end;
 }
 
+size_t CalculateUTF8Length(const LChar* characters, wtf_size_t length) {
+  // Characters above U+007F take two bytes. There is no branch, so that
+  // compilers can vectorize the loop.
+  size_t utf8_length = length;
+  for (wtf_size_t i = 0; i < length; ++i)
+    utf8_length += characters[i] >> 7;
+  return utf8_length;
+}
+
+size_t CalculateUTF8Length(const UChar* characters, wtf_size_t length) {
+  size_t utf8_length = 0;
+  for (wtf_size_t i = 0; i < length; ++i) {
+    UChar character = characters[i];
+    if (character < 0x80) {
+      utf8_length += 1;
+    } else if (character < 0x800) {
+      utf8_length += 2;
+    } else if (U16_IS_LEAD(character) && i + 1 < length &&
+               U16_IS_TRAIL(characters[i + 1])) {
+      utf8_length += 4;
+      ++i;
+    } else {
+      // This includes unpaired surrogates, which become U+FFFD.
+      utf8_length += 3;
+    }
+  }
+  return utf8_length;
+}
+
 bool EqualUTF16WithUTF8(const UChar* a,
                         const UChar* a_end,
                         const char* b,
@@ -28,6 +28,7 @@
 
 #include "third_party/blink/renderer/platform/wtf/text/unicode.h"
 #include "third_party/blink/renderer/platform/wtf/wtf_export.h"
+#include "third_party/blink/renderer/platform/wtf/wtf_size_t.h"
 
 namespace WTF {
 namespace unicode {
@@ -72,6 +73,13 @@ WTF_EXPORT ConversionResult ConvertUTF16ToUTF8(const UChar** source_start,
                                                char* target_end,
                                                bool strict = true);
 
+// Returns the length of the UTF-8 encoding of |characters|, with unpaired
+// surrogates encoded as U+FFFD REPLACEMENT CHARACTER like TextCodecUTF8 does.
+WTF_EXPORT size_t CalculateUTF8Length(const LChar* characters,
+                                      wtf_size_t length);
+WTF_EXPORT size_t CalculateUTF8Length(const UChar* characters,
+                                      wtf_size_t length);
+
 WTF_EXPORT unsigned CalculateStringHashAndLengthFromUTF8MaskingTop8Bits(
     const char* data,
     const char* data_end,
@@ -6,6 +6,7 @@
 
 #include <atomic>
 #include "build/build_config.h"
+#include "third_party/blink/renderer/platform/wtf/allocator/lifecycle_arena.h"
 #include "third_party/blink/renderer/platform/wtf/stack_util.h"
 #include "third_party/blink/renderer/platform/wtf/text/atomic_string_table.h"
 #include "third_party/blink/renderer/platform/wtf/text/text_codec_icu.h"
@@ -40,6 +41,7 @@ ThreadSpecific<Threading>* Threading::static_data_;
 Threading::Threading()
     : atomic_string_table_(new AtomicStringTable),
       cached_converter_icu_(new ICUConverterWrapper),
+      lifecycle_arena_(new LifecycleArena),
       thread_id_(CurrentThread()) {}
 
 Threading::~Threading() = default;
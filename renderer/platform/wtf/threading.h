@@ -52,6 +52,7 @@ WTF_EXPORT void SetIsBeforeThreadCreatedForTest();
 #endif
 
 class AtomicStringTable;
+class LifecycleArena;
 struct ICUConverterWrapper;
 
 class WTF_EXPORT Threading {
@@ -65,6 +66,8 @@ class WTF_EXPORT Threading {
 
   ICUConverterWrapper& CachedConverterICU() { return *cached_converter_icu_; }
 
+  LifecycleArena& GetLifecycleArena() { return *lifecycle_arena_; }
+
   base::PlatformThreadId ThreadId() const { return thread_id_; }
 
   // Must be called on the main thread before any callers to wtfThreadData().
@@ -77,6 +80,7 @@ class WTF_EXPORT Threading {
  private:
   std::unique_ptr<AtomicStringTable> atomic_string_table_;
   std::unique_ptr<ICUConverterWrapper> cached_converter_icu_;
+  std::unique_ptr<LifecycleArena> lifecycle_arena_;
 
   base::PlatformThreadId thread_id_;
 
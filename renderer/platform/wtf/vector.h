@@ -1764,10 +1764,11 @@ void Vector<T, inlineCapacity, Allocator>::ReserveCapacity(
 #ifdef ANNOTATE_CONTIGUOUS_CONTAINER
   wtf_size_t old_capacity = capacity();
 #endif
-  // The Allocator::isGarbageCollected check is not needed.  The check is just
-  // a static hint for a compiler to indicate that Base::expandBuffer returns
-  // false if Allocator is a PartitionAllocator.
-  if (Allocator::kIsGarbageCollected && Base::ExpandBuffer(new_capacity)) {
+  // The Allocator::kCanExpandVectorBackingInPlace check is not needed. The
+  // check is just a static hint for a compiler to indicate that
+  // Base::ExpandBuffer returns false if Allocator is a PartitionAllocator.
+  if (Allocator::kCanExpandVectorBackingInPlace &&
+      Base::ExpandBuffer(new_capacity)) {
     ANNOTATE_CHANGE_CAPACITY(begin(), old_capacity, size_, capacity());
     return;
   }